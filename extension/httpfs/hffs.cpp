@@ -53,7 +53,10 @@ static string ParseNextUrlFromLinkHeader(const string &link_header_content) {
 	throw IOException("Failed to parse Link header for paginated response, pagination support");
 }
 
-HFFileHandle::~HFFileHandle() {};
+HFFileHandle::~HFFileHandle() {
+	// read-ahead requests use the parsed url of this handle
+	FinishReadAhead();
+}
 
 void HFFileHandle::InitializeClient(optional_ptr<ClientContext> client_context) {
 	http_client = HTTPFileSystem::GetClient(this->http_params, parsed_url.endpoint.c_str(), this);
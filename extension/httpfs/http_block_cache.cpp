@@ -0,0 +1,284 @@
+#include "http_block_cache.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/extension_util.hpp"
+
+namespace duckdb {
+
+HTTPBlockCache::HTTPBlockCache()
+    : fs(FileSystem::CreateLocal()), max_size(0), current_size(0), temporary_file_count(0), hits(0), misses(0),
+      bytes_hit(0), bytes_missed(0), evictions(0) {
+}
+
+shared_ptr<HTTPBlockCache> HTTPBlockCache::Get(DatabaseInstance &db) {
+	return db.GetObjectCache().GetOrCreate<HTTPBlockCache>(HTTPBlockCache::ObjectType());
+}
+
+string HTTPBlockCache::GetKey(const string &url, const string &version, idx_t location, idx_t nr_bytes) {
+	return url + "\n" + version + "\n" + to_string(location) + "\n" + to_string(nr_bytes);
+}
+
+static string GetBlockFileName(const string &key) {
+	static constexpr const char *HEX_DIGITS = "0123456789abcdef";
+	// the file name is the hash of the key, the key itself is stored in the file to detect collisions
+	auto hash = Hash(key.c_str(), key.size());
+	string result;
+	for (idx_t i = 0; i < sizeof(hash_t) * 2; i++) {
+		result += HEX_DIGITS[(hash >> ((sizeof(hash_t) * 2 - 1 - i) * 4)) & 0xF];
+	}
+	return result + HTTPBlockCache::BLOCK_FILE_SUFFIX;
+}
+
+static void TryRemoveBlockFile(FileSystem &fs, const string &path) {
+	try {
+		fs.RemoveFile(path);
+	} catch (std::exception &ex) {
+		// the file might still be opened by a reader (or has already been removed)
+	}
+}
+
+string HTTPBlockCache::GetPath(const string &file_name) {
+	return fs->JoinPath(directory, file_name);
+}
+
+void HTTPBlockCache::Configure(const string &directory_p, idx_t max_size_p) {
+	unique_lock<mutex> guard(lock);
+	if (directory_p != directory) {
+		entries.clear();
+		lru.clear();
+		current_size = 0;
+		directory = directory_p;
+		if (!directory.empty()) {
+			if (!fs->DirectoryExists(directory)) {
+				fs->CreateDirectory(directory);
+			}
+			// load the blocks that were written by earlier sessions
+			vector<string> file_names;
+			fs->ListFiles(directory, [&](const string &file_name, bool is_directory) {
+				if (!is_directory) {
+					file_names.push_back(file_name);
+				}
+			});
+			for (auto &file_name : file_names) {
+				auto path = GetPath(file_name);
+				if (!StringUtil::EndsWith(file_name, BLOCK_FILE_SUFFIX)) {
+					if (StringUtil::Contains(file_name, string(BLOCK_FILE_SUFFIX) + ".tmp")) {
+						// left-over of an interrupted write
+						TryRemoveBlockFile(*fs, path);
+					}
+					continue;
+				}
+				auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+				if (!handle) {
+					continue;
+				}
+				auto size = NumericCast<idx_t>(handle->GetFileSize());
+				lru.push_back(file_name);
+				entries[file_name] = BlockCacheEntry {size, std::prev(lru.end())};
+				current_size += size;
+			}
+		}
+	}
+	max_size = max_size_p;
+	EvictBlocks();
+}
+
+void HTTPBlockCache::RemoveEntry(unordered_map<string, BlockCacheEntry>::iterator entry) {
+	current_size -= entry->second.size;
+	lru.erase(entry->second.lru_position);
+	entries.erase(entry);
+}
+
+void HTTPBlockCache::EvictBlocks() {
+	while (current_size > max_size && !lru.empty()) {
+		auto file_name = lru.front();
+		RemoveEntry(entries.find(file_name));
+		evictions++;
+		TryRemoveBlockFile(*fs, GetPath(file_name));
+	}
+}
+
+bool HTTPBlockCache::TryRead(const string &url, const string &version, idx_t location, data_ptr_t buffer,
+                             idx_t nr_bytes) {
+	auto key = GetKey(url, version, location, nr_bytes);
+	auto file_name = GetBlockFileName(key);
+
+	unique_lock<mutex> guard(lock);
+	if (directory.empty()) {
+		return false;
+	}
+	auto entry = entries.find(file_name);
+	if (entry == entries.end()) {
+		misses++;
+		bytes_missed += nr_bytes;
+		return false;
+	}
+	// mark the block as most recently used
+	lru.splice(lru.end(), lru, entry->second.lru_position);
+	auto path = GetPath(file_name);
+	guard.unlock();
+
+	bool success = false;
+	try {
+		auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (handle && NumericCast<idx_t>(handle->GetFileSize()) == sizeof(uint64_t) + key.size() + nr_bytes) {
+			uint64_t key_size;
+			handle->Read(&key_size, sizeof(uint64_t), 0);
+			if (key_size == key.size()) {
+				string stored_key(key_size, '\0');
+				handle->Read(&stored_key[0], key_size, sizeof(uint64_t));
+				if (stored_key == key) {
+					handle->Read(buffer, nr_bytes, sizeof(uint64_t) + key_size);
+					success = true;
+				}
+			}
+		}
+	} catch (std::exception &ex) {
+		success = false;
+	}
+
+	guard.lock();
+	if (!success) {
+		// the block is missing or corrupt (or another key hashes to the same file name): drop it
+		entry = entries.find(file_name);
+		if (entry != entries.end()) {
+			RemoveEntry(entry);
+		}
+		misses++;
+		bytes_missed += nr_bytes;
+		return false;
+	}
+	hits++;
+	bytes_hit += nr_bytes;
+	return true;
+}
+
+void HTTPBlockCache::Write(const string &url, const string &version, idx_t location, const_data_ptr_t buffer,
+                           idx_t nr_bytes) {
+	auto key = GetKey(url, version, location, nr_bytes);
+	auto file_name = GetBlockFileName(key);
+	auto size = sizeof(uint64_t) + key.size() + nr_bytes;
+
+	unique_lock<mutex> guard(lock);
+	if (directory.empty() || size > max_size || entries.find(file_name) != entries.end()) {
+		return;
+	}
+	auto cache_directory = directory;
+	auto path = GetPath(file_name);
+	// write to a temporary file first so that readers never observe a partially written block
+	auto tmp_path = path + ".tmp" + to_string(temporary_file_count++);
+	guard.unlock();
+
+	try {
+		auto handle = fs->OpenFile(tmp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		uint64_t key_size = key.size();
+		handle->Write(&key_size, sizeof(uint64_t), 0);
+		handle->Write((void *)key.c_str(), key_size, sizeof(uint64_t));
+		handle->Write((void *)buffer, nr_bytes, sizeof(uint64_t) + key_size);
+		handle->Close();
+		fs->MoveFile(tmp_path, path);
+	} catch (std::exception &ex) {
+		// failing to write to the cache is not an error, the block is simply not cached
+		TryRemoveBlockFile(*fs, tmp_path);
+		return;
+	}
+
+	guard.lock();
+	if (cache_directory != directory || entries.find(file_name) != entries.end()) {
+		return;
+	}
+	lru.push_back(file_name);
+	entries[file_name] = BlockCacheEntry {size, std::prev(lru.end())};
+	current_size += size;
+	EvictBlocks();
+}
+
+HTTPBlockCacheStatistics HTTPBlockCache::GetStatistics() {
+	lock_guard<mutex> guard(lock);
+	HTTPBlockCacheStatistics result;
+	result.directory = directory;
+	result.max_size = max_size;
+	result.size = current_size;
+	result.entries = entries.size();
+	result.hits = hits;
+	result.misses = misses;
+	result.bytes_hit = bytes_hit;
+	result.bytes_missed = bytes_missed;
+	result.evictions = evictions;
+	return result;
+}
+
+struct HTTPBlockCacheStatsData : public GlobalTableFunctionState {
+	HTTPBlockCacheStatsData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> HTTPBlockCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("directory");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("max_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bytes_hit");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bytes_missed");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> HTTPBlockCacheStatsInit(ClientContext &context,
+                                                                    TableFunctionInitInput &input) {
+	return make_uniq<HTTPBlockCacheStatsData>();
+}
+
+static void HTTPBlockCacheStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<HTTPBlockCacheStatsData>();
+	if (data.finished) {
+		return;
+	}
+	auto stats = HTTPBlockCache::Get(*context.db)->GetStatistics();
+	idx_t col = 0;
+	output.SetValue(col++, 0, stats.directory.empty() ? Value() : Value(stats.directory));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.max_size)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.size)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.entries)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.hits)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.misses)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.bytes_hit)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.bytes_missed)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(stats.evictions)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void HTTPBlockCacheFunctions::Register(DatabaseInstance &instance) {
+	TableFunction stats_fun("http_block_cache_stats", {}, HTTPBlockCacheStatsFunction, HTTPBlockCacheStatsBind,
+	                        HTTPBlockCacheStatsInit);
+	ExtensionUtil::RegisterFunction(instance, stats_fun);
+}
+
+} // namespace duckdb
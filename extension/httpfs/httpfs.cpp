@@ -42,6 +42,9 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	std::string ca_cert_file;
 	uint64_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	uint64_t read_ahead_requests = DEFAULT_READ_AHEAD_REQUESTS;
+	string block_cache_directory;
+	idx_t block_cache_max_size = DBConfig::ParseMemoryLimit(DEFAULT_BLOCK_CACHE_MAX_SIZE);
 
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
@@ -71,6 +74,15 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", value)) {
 		hf_max_per_page = value.GetValue<uint64_t>();
 	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_read_ahead_requests", value)) {
+		read_ahead_requests = value.GetValue<uint64_t>();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_directory", value)) {
+		block_cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_max_size", value)) {
+		block_cache_max_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
 	return {timeout,
 	        retries,
@@ -81,7 +93,10 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	        enable_server_cert_verification,
 	        ca_cert_file,
 	        "",
-	        hf_max_per_page};
+	        hf_max_per_page,
+	        read_ahead_requests,
+	        block_cache_directory,
+	        block_cache_max_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -340,11 +355,14 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 
 	idx_t out_offset = 0;
 
+	// range requests can be issued concurrently by read-ahead requests, so we use a client from the cache
+	auto client = hfs.GetRangeClient(proto_host_port);
+
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
 		if (hfs.state) {
 			hfs.state->get_count++;
 		}
-		return hfs.http_client->Get(
+		return client->Get(
 		    path.c_str(), *headers,
 		    [&](const duckdb_httplib_openssl::Response &response) {
 			    if (response.status >= 400) {
@@ -388,15 +406,16 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 		    });
 	});
 
-	std::function<void(void)> on_retry(
-	    [&]() { hfs.http_client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
+	std::function<void(void)> on_retry([&]() { client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
 
-	return RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	auto result = RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	hfs.StoreRangeClient(std::move(client));
+	return result;
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
@@ -438,6 +457,220 @@ unique_ptr<FileHandle> HTTPFileSystem::OpenFile(const string &path, FileOpenFlag
 	return std::move(handle);
 }
 
+unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::GetRangeClient(const string &proto_host_port) {
+	{
+		lock_guard<mutex> guard(client_cache_lock);
+		if (!client_cache.empty()) {
+			auto client = std::move(client_cache.back());
+			client_cache.pop_back();
+			return client;
+		}
+	}
+	return HTTPFileSystem::GetClient(http_params, proto_host_port.c_str(), this);
+}
+
+void HTTPFileHandle::StoreRangeClient(unique_ptr<duckdb_httplib_openssl::Client> client) {
+	lock_guard<mutex> guard(client_cache_lock);
+	client_cache.push_back(std::move(client));
+}
+
+//! Fetches the queued read-ahead ranges of a file
+class HTTPReadAheadTask : public Task {
+public:
+	explicit HTTPReadAheadTask(HTTPFileHandle &handle) : handle(handle) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		handle.RunReadAhead();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	HTTPFileHandle &handle;
+};
+
+bool HTTPFileHandle::RegisterReadAhead(idx_t location, idx_t nr_bytes) {
+	if (!buffer_manager || !scheduler) {
+		return false;
+	}
+	lock_guard<mutex> guard(read_ahead_lock);
+	auto end = location + nr_bytes;
+	bool registered = false;
+	for (auto &read_ahead_buffer : read_ahead_buffers) {
+		auto buffer_end = read_ahead_buffer->location + read_ahead_buffer->size;
+		if (read_ahead_buffer->location <= location && end <= buffer_end) {
+			// the range is already being fetched
+			return true;
+		}
+		if (read_ahead_buffer->started) {
+			continue;
+		}
+		// merge the range with a queued range if they are close to each other
+		auto merged_start = MinValue(location, read_ahead_buffer->location);
+		auto merged_end = MaxValue(end, buffer_end);
+		if (location > buffer_end + READ_AHEAD_MERGE_GAP || read_ahead_buffer->location > end + READ_AHEAD_MERGE_GAP ||
+		    merged_end - merged_start > READ_AHEAD_MAX_REQUEST_SIZE) {
+			continue;
+		}
+		if (read_ahead_bytes + (merged_end - merged_start) - read_ahead_buffer->size > READ_AHEAD_MAX_BYTES) {
+			return false;
+		}
+		read_ahead_bytes += (merged_end - merged_start) - read_ahead_buffer->size;
+		read_ahead_buffer->location = merged_start;
+		read_ahead_buffer->size = merged_end - merged_start;
+		read_ahead_buffer->registered_bytes += nr_bytes;
+		registered = true;
+		break;
+	}
+	if (!registered) {
+		if (read_ahead_bytes + nr_bytes > READ_AHEAD_MAX_BYTES) {
+			return false;
+		}
+		read_ahead_buffers.push_back(make_shared_ptr<HTTPReadAheadBuffer>(location, nr_bytes));
+		read_ahead_bytes += nr_bytes;
+	}
+	// start another request if we can
+	if (read_ahead_requests_active < http_params.read_ahead_requests) {
+		read_ahead_requests_active++;
+		scheduler->ScheduleTask(*read_ahead_producer, make_shared_ptr<HTTPReadAheadTask>(*this));
+	}
+	return true;
+}
+
+void HTTPFileHandle::RunReadAhead() {
+	while (true) {
+		shared_ptr<HTTPReadAheadBuffer> next_buffer;
+		{
+			lock_guard<mutex> guard(read_ahead_lock);
+			for (auto &read_ahead_buffer : read_ahead_buffers) {
+				if (!read_ahead_buffer->started) {
+					next_buffer = read_ahead_buffer;
+					break;
+				}
+			}
+			if (!next_buffer) {
+				// nothing left to fetch
+				read_ahead_requests_active--;
+				read_ahead_cv.notify_all();
+				return;
+			}
+			next_buffer->started = true;
+		}
+		FetchReadAhead(*next_buffer);
+	}
+}
+
+void HTTPFileHandle::ReadRange(idx_t location, char *buffer, idx_t nr_bytes) {
+	if (block_cache && block_cache->TryRead(path, block_cache_version, location, data_ptr_cast(buffer), nr_bytes)) {
+		return;
+	}
+	auto &hfs = file_system.Cast<HTTPFileSystem>();
+	hfs.GetRangeRequest(*this, path, {}, location, buffer, nr_bytes);
+	if (block_cache) {
+		block_cache->Write(path, block_cache_version, location, const_data_ptr_cast(buffer), nr_bytes);
+	}
+}
+
+void HTTPFileHandle::FetchReadAhead(HTTPReadAheadBuffer &read_ahead_buffer) {
+	shared_ptr<BlockHandle> block;
+	bool success = false;
+	try {
+		// the buffer is unpinned once it has been filled, so it can be evicted (and destroyed) until it is read
+		auto buffer = buffer_manager->Allocate(MemoryTag::EXTENSION, read_ahead_buffer.size, true, &block);
+		ReadRange(read_ahead_buffer.location, char_ptr_cast(buffer.Ptr()), read_ahead_buffer.size);
+		success = true;
+	} catch (std::exception &ex) { // NOLINT
+		// the range is requested again when it is read, which reports the error (if any)
+	}
+	lock_guard<mutex> guard(read_ahead_lock);
+	read_ahead_buffer.block = std::move(block);
+	read_ahead_buffer.finished = success;
+	read_ahead_buffer.failed = !success;
+	read_ahead_cv.notify_all();
+}
+
+bool HTTPFileHandle::ReadFromReadAhead(data_ptr_t buffer, idx_t nr_bytes, idx_t location) {
+	unique_lock<mutex> guard(read_ahead_lock);
+	if (read_ahead_buffers.empty()) {
+		return false;
+	}
+	idx_t buffer_idx;
+	for (buffer_idx = 0; buffer_idx < read_ahead_buffers.size(); buffer_idx++) {
+		auto &read_ahead_buffer = *read_ahead_buffers[buffer_idx];
+		if (read_ahead_buffer.location <= location &&
+		    location + nr_bytes <= read_ahead_buffer.location + read_ahead_buffer.size) {
+			break;
+		}
+	}
+	if (buffer_idx == read_ahead_buffers.size()) {
+		return false;
+	}
+	auto read_ahead_buffer = read_ahead_buffers[buffer_idx];
+	if (!read_ahead_buffer->started) {
+		// no request has been started for this range yet: fetch it ourselves
+		read_ahead_buffer->started = true;
+		guard.unlock();
+		FetchReadAhead(*read_ahead_buffer);
+		guard.lock();
+	}
+	read_ahead_cv.wait(guard, [&]() { return read_ahead_buffer->finished || read_ahead_buffer->failed; });
+
+	bool success = read_ahead_buffer->finished;
+	if (success) {
+		auto handle = buffer_manager->Pin(read_ahead_buffer->block);
+		if (handle.IsValid()) {
+			memcpy(buffer, handle.Ptr() + (location - read_ahead_buffer->location), nr_bytes);
+		} else {
+			// the buffer has been evicted: the range has to be requested again
+			success = false;
+		}
+	}
+	read_ahead_buffer->read_bytes += nr_bytes;
+	if (!success || read_ahead_buffer->read_bytes >= read_ahead_buffer->registered_bytes ||
+	    location + nr_bytes == read_ahead_buffer->location + read_ahead_buffer->size) {
+		// the registered ranges have been read (or the range could not be fetched): release the buffer
+		for (idx_t i = 0; i < read_ahead_buffers.size(); i++) {
+			if (read_ahead_buffers[i] == read_ahead_buffer) {
+				read_ahead_bytes -= read_ahead_buffer->size;
+				read_ahead_buffers.erase_at(i);
+				break;
+			}
+		}
+	}
+	return success;
+}
+
+void HTTPFileHandle::FinishReadAhead() {
+	unique_lock<mutex> guard(read_ahead_lock);
+	// drop the ranges that have not been started yet
+	for (auto &read_ahead_buffer : read_ahead_buffers) {
+		read_ahead_buffer->started = true;
+	}
+	if (scheduler && read_ahead_requests_active > 0) {
+		// run the tasks that have not been picked up by a thread yet, these finish immediately
+		guard.unlock();
+		shared_ptr<Task> task;
+		while (scheduler->GetTaskFromProducer(*read_ahead_producer, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		}
+		guard.lock();
+	}
+	// wait for the running requests
+	read_ahead_cv.wait(guard, [&]() { return read_ahead_requests_active == 0; });
+	read_ahead_buffers.clear();
+	read_ahead_bytes = 0;
+}
+
+bool HTTPFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	auto &hfh = handle.Cast<HTTPFileHandle>();
+	if (hfh.cached_file_handle || hfh.http_params.read_ahead_requests == 0 ||
+	    location >= hfh.length || nr_bytes == 0) {
+		return false;
+	}
+	return hfh.RegisterReadAhead(location, MinValue<idx_t>(nr_bytes, hfh.length - location));
+}
+
 // Buffered read from http file.
 // Note that buffering is disabled when FileFlags::FILE_FLAGS_DIRECT_IO is set
 void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
@@ -453,13 +686,19 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		return;
 	}
 
+	// ranges that were registered for read-ahead are read from the read-ahead buffers
+	if (nr_bytes > 0 && hfh.ReadFromReadAhead(data_ptr_cast(buffer), NumericCast<idx_t>(nr_bytes), location)) {
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
+
 	idx_t to_read = nr_bytes;
 	idx_t buffer_offset = 0;
 
 	// Don't buffer when DirectIO is set or when we are doing parallel reads
 	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
 	if (skip_buffer && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		hfh.ReadRange(location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -495,14 +734,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				hfh.ReadRange(location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				hfh.ReadRange(hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -610,6 +848,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 	if (!state) {
 		state = make_shared_ptr<HTTPState>();
 	}
+	auto db = FileOpener::TryGetDatabase(opener);
+	if (db) {
+		buffer_manager = &BufferManager::GetBufferManager(*db);
+		scheduler = &TaskScheduler::GetScheduler(*db);
+		read_ahead_producer = scheduler->CreateProducer();
+	}
 
 	auto current_cache = TryGetMetadataCache(opener, hfs);
 
@@ -622,9 +866,11 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
+				InitializeBlockCache(db);
 			}
 			return;
 		}
@@ -731,12 +977,32 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	etag = res->headers["ETag"];
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	if (flags.OpenForReading() && !cached_file_handle) {
+		InitializeBlockCache(db);
 	}
 }
 
+void HTTPFileHandle::InitializeBlockCache(optional_ptr<DatabaseInstance> db) {
+	if (!db || http_params.block_cache_directory.empty() || http_params.block_cache_max_size == 0) {
+		return;
+	}
+	// cached ranges are only valid for the same version of the file
+	if (!etag.empty()) {
+		block_cache_version = "etag:" + etag;
+	} else if (last_modified != 0) {
+		block_cache_version = "modified:" + to_string(last_modified) + ":" + to_string(length);
+	} else {
+		return;
+	}
+	block_cache = HTTPBlockCache::Get(*db);
+	block_cache->Configure(http_params.block_cache_directory, http_params.block_cache_max_size);
+}
+
 void HTTPFileHandle::InitializeClient(optional_ptr<ClientContext> context) {
 	string path_out, proto_host_port;
 	HTTPFileSystem::ParseUrl(path, path_out, proto_host_port);
@@ -758,5 +1024,7 @@ ResponseWrapper::ResponseWrapper(duckdb_httplib_openssl::Response &res, string &
 	body = res.body;
 }
 
-HTTPFileHandle::~HTTPFileHandle() = default;
+HTTPFileHandle::~HTTPFileHandle() {
+	FinishReadAhead();
+}
 } // namespace duckdb
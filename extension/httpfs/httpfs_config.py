@@ -10,6 +10,6 @@ source_files = [
     os.path.sep.join(x.split('/'))
     for x in [
         'extension/httpfs/' + s
-        for s in ['create_secret_functions.cpp', 'httpfs_extension.cpp', 'httpfs.cpp', 's3fs.cpp', 'crypto.cpp']
+        for s in ['create_secret_functions.cpp', 'httpfs_extension.cpp', 'httpfs.cpp', 's3fs.cpp', 'crypto.cpp', 'http_block_cache.cpp']
     ]
 ]
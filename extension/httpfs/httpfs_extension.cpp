@@ -38,6 +38,14 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_read_ahead_requests",
+	                          "Maximum number of concurrent read-ahead requests per remote file (0 to disable)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(HTTPParams::DEFAULT_READ_AHEAD_REQUESTS));
+	config.AddExtensionOption("http_block_cache_directory",
+	                          "Directory of the persistent cache of remote file ranges (empty to disable)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_max_size", "Maximum size of the persistent cache of remote file ranges",
+	                          LogicalType::VARCHAR, Value(HTTPParams::DEFAULT_BLOCK_CACHE_MAX_SIZE));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -66,6 +74,7 @@ static void LoadInternal(DatabaseInstance &instance) {
 
 	CreateS3SecretFunctions::Register(instance);
 	CreateBearerTokenFunctions::Register(instance);
+	HTTPBlockCacheFunctions::Register(instance);
 }
 
 void HttpfsExtension::Load(DuckDB &db) {
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+struct HTTPBlockCacheStatistics {
+	string directory;
+	idx_t max_size = 0;
+	idx_t size = 0;
+	idx_t entries = 0;
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t bytes_hit = 0;
+	idx_t bytes_missed = 0;
+	idx_t evictions = 0;
+};
+
+//! The HTTPBlockCache is a persistent on-disk cache of byte ranges of remote files. Every range is stored in its own
+//! file, the name of which is derived from the url, the version (ETag) of the remote file and the range. The cache is
+//! bounded in size, the least recently used ranges are evicted first.
+class HTTPBlockCache : public ObjectCacheEntry {
+public:
+	HTTPBlockCache();
+
+	//! The suffix of the files that are written to the cache directory
+	static constexpr const char *BLOCK_FILE_SUFFIX = ".block";
+
+public:
+	static string ObjectType() {
+		return "http_block_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! Get the block cache of a database
+	static shared_ptr<HTTPBlockCache> Get(DatabaseInstance &db);
+
+	//! (Re)configure the cache - if the directory changes the entries of the new directory are loaded
+	void Configure(const string &directory, idx_t max_size);
+	//! Read a range of a remote file from the cache, returns false if the range is not cached
+	bool TryRead(const string &url, const string &version, idx_t location, data_ptr_t buffer, idx_t nr_bytes);
+	//! Write a range of a remote file to the cache
+	void Write(const string &url, const string &version, idx_t location, const_data_ptr_t buffer, idx_t nr_bytes);
+
+	HTTPBlockCacheStatistics GetStatistics();
+
+private:
+	struct BlockCacheEntry {
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+
+	static string GetKey(const string &url, const string &version, idx_t location, idx_t nr_bytes);
+	string GetPath(const string &file_name);
+	void EvictBlocks();
+	void RemoveEntry(unordered_map<string, BlockCacheEntry>::iterator entry);
+
+private:
+	unique_ptr<FileSystem> fs;
+
+	mutex lock;
+	string directory;
+	idx_t max_size;
+	idx_t current_size;
+	//! The cached blocks, indexed by file name
+	unordered_map<string, BlockCacheEntry> entries;
+	//! The file names of the cached blocks, from least to most recently used
+	list<string> lru;
+	//! Used to generate unique names for the files that are being written
+	idx_t temporary_file_count;
+
+	idx_t hits;
+	idx_t misses;
+	idx_t bytes_hit;
+	idx_t bytes_missed;
+	idx_t evictions;
+};
+
+struct HTTPBlockCacheFunctions {
+	//! Registers the http_block_cache_stats() table function
+	static void Register(DatabaseInstance &instance);
+};
+
+} // namespace duckdb
@@ -6,8 +6,13 @@
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "http_block_cache.hpp"
 #include "http_metadata_cache.hpp"
 
+#include <condition_variable>
+
 namespace duckdb_httplib_openssl {
 struct Response;
 struct Result;
@@ -41,6 +46,8 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr uint64_t DEFAULT_READ_AHEAD_REQUESTS = 8;
+	static constexpr const char *DEFAULT_BLOCK_CACHE_MAX_SIZE = "4GB";
 
 	uint64_t timeout;
 	uint64_t retries;
@@ -55,10 +62,40 @@ struct HTTPParams {
 
 	idx_t hf_max_per_page;
 
+	//! The maximum number of concurrent read-ahead requests per file (0 disables read-ahead)
+	idx_t read_ahead_requests;
+
+	//! The directory of the persistent block cache (empty if the cache is disabled) and its maximum size in bytes
+	string block_cache_directory;
+	idx_t block_cache_max_size;
+
 	static HTTPParams ReadFrom(optional_ptr<FileOpener> opener);
 };
 
+//! A range of a file that is fetched ahead of time by a background request
+struct HTTPReadAheadBuffer {
+	HTTPReadAheadBuffer(idx_t location, idx_t size) : location(location), size(size), registered_bytes(size) {
+	}
+
+	idx_t location;
+	idx_t size;
+	//! The number of bytes of the registered ranges (which can be smaller than the size if ranges were merged), and
+	//! the number of bytes that have been read from the buffer. The buffer is released once they have all been read
+	idx_t registered_bytes;
+	idx_t read_bytes = 0;
+	//! Whether or not a request for the range has been started
+	bool started = false;
+	//! Whether or not the request has finished, and if it succeeded
+	bool finished = false;
+	bool failed = false;
+	//! The data of the range, in a block of the buffer manager that is not pinned until it is read (and destroyed if
+	//! it is evicted in the meantime)
+	shared_ptr<BlockHandle> block;
+};
+
 class HTTPFileHandle : public FileHandle {
+	friend class HTTPReadAheadTask;
+
 public:
 	HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &params);
 	~HTTPFileHandle() override;
@@ -75,6 +112,7 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
@@ -92,14 +130,63 @@ public:
 
 	shared_ptr<HTTPState> state;
 
+	//! Read-ahead: ranges are merged when they are at most READ_AHEAD_MERGE_GAP bytes apart, up to a request size of
+	//! READ_AHEAD_MAX_REQUEST_SIZE. At most READ_AHEAD_MAX_BYTES are buffered at the same time
+	constexpr static idx_t READ_AHEAD_MERGE_GAP = 1 << 16;
+	constexpr static idx_t READ_AHEAD_MAX_REQUEST_SIZE = 1 << 24;
+	constexpr static idx_t READ_AHEAD_MAX_BYTES = 1 << 28;
+
 	void AddHeaders(HeaderMap &map);
 
+	//! Reads a range of the file, either from the block cache or with a range request
+	void ReadRange(idx_t location, char *buffer, idx_t nr_bytes);
+
+	//! Gets a client for a range request, these are cached as clients cannot be used by multiple threads at once
+	duckdb::unique_ptr<duckdb_httplib_openssl::Client> GetRangeClient(const string &proto_host_port);
+	void StoreRangeClient(duckdb::unique_ptr<duckdb_httplib_openssl::Client> client);
+
+	//! Registers a range that will be read soon, and starts fetching it in the background
+	bool RegisterReadAhead(idx_t location, idx_t nr_bytes);
+	//! Reads a range from the read-ahead buffers, waiting for the background request if required. Returns false if
+	//! the range is not (fully) covered by a read-ahead buffer
+	bool ReadFromReadAhead(data_ptr_t buffer, idx_t nr_bytes, idx_t location);
+	//! Cancels the background requests that have not started yet, waits for the running ones to finish, and drops all
+	//! read-ahead buffers
+	void FinishReadAhead();
+
 public:
 	void Close() override {
+		FinishReadAhead();
 	}
 
 protected:
 	virtual void InitializeClient(optional_ptr<ClientContext> client_context);
+	//! Sets up the persistent block cache for this file if it is enabled
+	void InitializeBlockCache(optional_ptr<DatabaseInstance> db);
+
+private:
+	void RunReadAhead();
+	void FetchReadAhead(HTTPReadAheadBuffer &read_ahead_buffer);
+
+private:
+	//! The buffer manager that is used to allocate the read-ahead buffers (if any)
+	optional_ptr<BufferManager> buffer_manager;
+	//! The task scheduler that runs the read-ahead requests, and the producer token of these tasks
+	optional_ptr<TaskScheduler> scheduler;
+	unique_ptr<ProducerToken> read_ahead_producer;
+	//! The persistent block cache (if enabled), and the version of the file that is used to key the cached ranges
+	shared_ptr<HTTPBlockCache> block_cache;
+	string block_cache_version;
+
+	mutex client_cache_lock;
+	vector<duckdb::unique_ptr<duckdb_httplib_openssl::Client>> client_cache;
+
+	mutex read_ahead_lock;
+	std::condition_variable read_ahead_cv;
+	//! The ranges that are queued, being fetched or fetched but not yet read, in order of registration
+	vector<shared_ptr<HTTPReadAheadBuffer>> read_ahead_buffers;
+	idx_t read_ahead_bytes = 0;
+	idx_t read_ahead_requests_active = 0;
 };
 
 class HTTPFileSystem : public FileSystem {
@@ -136,6 +223,7 @@ public:
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	void FileSync(FileHandle &handle) override;
+	bool ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) override;
 	int64_t GetFileSize(FileHandle &handle) override;
 	time_t GetLastModifiedTime(FileHandle &handle) override;
 	bool FileExists(const string &filename, optional_ptr<FileOpener> opener) override;
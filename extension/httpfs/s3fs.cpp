@@ -321,6 +321,8 @@ S3AuthParams S3SecretHelper::GetParams(const KeyValueSecret &secret) {
 }
 
 S3FileHandle::~S3FileHandle() {
+	// read-ahead requests use the authentication parameters of this handle
+	FinishReadAhead();
 	if (Exception::UncaughtException()) {
 		// We are in an exception, don't do anything
 		return;
@@ -360,6 +362,7 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 }
 
 void S3FileHandle::Close() {
+	FinishReadAhead();
 	auto &s3fs = (S3FileSystem &)file_system;
 	if (flags.OpenForWriting() && !upload_finalized) {
 		s3fs.FlushAllBuffers(*this);
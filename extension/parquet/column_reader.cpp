@@ -145,9 +145,51 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	if (chunk) {
-		uint64_t size = chunk->meta_data.total_compressed_size;
-		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+	if (!chunk) {
+		return;
+	}
+	if (offset_index && !offset_index->page_locations.empty()) {
+		// only register the dictionary and the pages that contain rows we might read
+		auto &page_locations = offset_index->page_locations;
+		auto start_offset = FileOffset();
+		auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+		if (first_page_offset > start_offset) {
+			transport.RegisterPrefetch(start_offset, first_page_offset - start_offset, allow_merge);
+		}
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			if (skipped_pages[page_idx]) {
+				continue;
+			}
+			transport.RegisterPrefetch(NumericCast<idx_t>(page_locations[page_idx].offset),
+			                           NumericCast<idx_t>(page_locations[page_idx].compressed_page_size),
+			                           allow_merge);
+		}
+		return;
+	}
+	uint64_t size = chunk->meta_data.total_compressed_size;
+	transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+}
+
+void ColumnReader::SetPageIndex(unique_ptr<OffsetIndex> offset_index_p, const vector<ParquetRowRange> &skipped_ranges) {
+	if (!chunk || max_repeat > 0) {
+		// page skipping is only supported for flat columns, for which the rows are the values
+		return;
+	}
+	offset_index = std::move(offset_index_p);
+	auto &page_locations = offset_index->page_locations;
+	skipped_pages.clear();
+	skipped_pages.resize(page_locations.size(), false);
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto page_end = page_idx + 1 < page_locations.size()
+		                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                    : NumericCast<idx_t>(chunk->meta_data.num_values);
+		for (auto &range : skipped_ranges) {
+			if (range.start <= page_start && range.end >= page_end) {
+				skipped_pages[page_idx] = true;
+				break;
+			}
+		}
 	}
 }
 
@@ -236,6 +278,8 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index.reset();
+	skipped_pages.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -585,6 +629,31 @@ void ColumnReader::Skip(idx_t num_values) {
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	if (offset_index && num_values > page_rows_available) {
+		// use the offset index to jump to the page that contains the first row we need to read
+		auto &page_locations = offset_index->page_locations;
+		auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+		auto target_row = current_row + num_values;
+		idx_t page_idx = page_locations.size();
+		while (page_idx > 0 && NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) > target_row) {
+			page_idx--;
+		}
+		if (page_idx > 0 && NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) > current_row) {
+			auto &page_location = page_locations[page_idx - 1];
+			auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+			// the dictionary precedes the data pages: make sure we have read it before jumping
+			while (trans.GetLocation() < NumericCast<idx_t>(page_locations[0].offset)) {
+				PrepareRead(none_filter);
+			}
+			auto skipped_rows = NumericCast<idx_t>(page_location.first_row_index) - current_row;
+			trans.SetLocation(NumericCast<idx_t>(page_location.offset));
+			chunk_read_offset = trans.GetLocation();
+			page_rows_available = 0;
+			group_rows_available -= skipped_rows;
+			num_values -= skipped_rows;
+		}
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -31,12 +32,16 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BoundaryOrder;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -89,6 +94,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -326,6 +334,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, only gathered when writing the page index
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -348,6 +358,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The Bloom filter of the column chunk (if any)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -373,6 +385,9 @@ public:
 	//! we stop creating the dictionary
 	static constexpr const idx_t DICTIONARY_ANALYZE_THRESHOLD = 1e4;
 
+	//! The maximum number of rows in a page when writing the page index, so that readers can skip parts of a row group
+	static constexpr const idx_t PAGE_INDEX_MAX_PAGE_ROW_COUNT = 20000;
+
 	//! The maximum size a key entry in an RLE page takes
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	//! The size of encoding the string length
@@ -419,6 +434,12 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+
+	//! Whether or not the page index (ColumnIndex/OffsetIndex) is written for this column
+	bool HasPageIndex() const {
+		return writer.WritePageIndex() && max_repeat == 0;
+	}
+	unique_ptr<duckdb_parquet::format::ColumnIndex> CreateColumnIndex(BasicColumnWriterState &state);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -455,6 +476,9 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	// with a page index we write smaller pages, so that readers can skip the pages they do not need
+	auto max_page_row_count = HasPageIndex() ? PAGE_INDEX_MAX_PAGE_ROW_COUNT : NumericLimits<idx_t>::Maximum();
+
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = state.page_info.back();
@@ -466,7 +490,8 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE ||
+			    page_info.row_count >= max_page_row_count) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -509,6 +534,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (HasPageIndex()) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -598,6 +626,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 		D_ASSERT(write_info.compressed_buf.get() == write_info.compressed_data);
 		write_info.temp_writer.reset();
 	}
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 }
 
 unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
@@ -622,8 +653,9 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		// when writing the page index we gather statistics per page, these are merged when the page is flushed
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -696,6 +728,13 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	column_chunk.meta_data.data_page_offset = 0;
 	SetParquetStatistics(state, column_chunk);
 
+	unique_ptr<ColumnIndex> column_index;
+	unique_ptr<OffsetIndex> offset_index;
+	if (HasPageIndex()) {
+		column_index = CreateColumnIndex(state);
+		offset_index = make_uniq<OffsetIndex>();
+	}
+
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
 	for (auto &write_info : state.write_info) {
@@ -712,9 +751,62 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (offset_index && write_info.page_header.type == PageType::DATA_PAGE) {
+			// the location of a page includes its header
+			PageLocation page_location;
+			page_location.offset = NumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index =
+			    NumericCast<int64_t>(state.page_info[offset_index->page_locations.size()].offset);
+			offset_index->page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (offset_index || state.bloom_filter) {
+		// the page index and Bloom filter are written after all row groups
+		ParquetColumnChunkIndex chunk_index;
+		chunk_index.column_idx = state.col_idx;
+		chunk_index.column_index = std::move(column_index);
+		chunk_index.offset_index = std::move(offset_index);
+		chunk_index.bloom_filter = std::move(state.bloom_filter);
+		writer.AddColumnChunkIndex(std::move(chunk_index));
+	}
+}
+
+unique_ptr<ColumnIndex> BasicColumnWriter::CreateColumnIndex(BasicColumnWriterState &state) {
+	auto column_index = make_uniq<ColumnIndex>();
+	column_index->boundary_order = BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type != PageType::DATA_PAGE) {
+			continue;
+		}
+		auto &page_info = state.page_info[page_idx++];
+		int64_t null_count = 0;
+		if (!state.definition_levels.empty()) {
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				if (state.definition_levels[i] != max_define) {
+					null_count++;
+				}
+			}
+		}
+		bool null_page = idx_t(null_count) == page_info.row_count;
+		auto &page_stats = *write_info.page_stats;
+		if (!null_page && !page_stats.HasStats()) {
+			// we have no statistics for this page: we cannot write a column index for this column chunk
+			return nullptr;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+		column_index->null_counts.push_back(null_count);
+	}
+	return column_index;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -784,6 +876,18 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (!other.HasStats()) {
+			return;
+		}
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -930,6 +1034,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1061,6 +1170,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1243,6 +1359,20 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1386,6 +1516,11 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (HasPageIndex()) {
+					// the statistics of dictionary encoded columns are usually computed from the dictionary, but the
+					// page index needs the statistics of every page
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1456,12 +1591,21 @@ public:
 			D_ASSERT(values[entry.second].GetSize() == 0);
 			values[entry.second] = entry.first;
 		}
+		if (writer.WriteBloomFilter()) {
+			state.bloom_filter = make_uniq<ParquetBloomFilter>(Allocator::DefaultAllocator(), values.size(),
+			                                                   writer.BloomFilterFalsePositiveRatio());
+		}
 		// first write the contents of the dictionary page to a temporary buffer
 		auto temp_writer = make_uniq<MemoryStream>();
 		for (idx_t r = 0; r < values.size(); r++) {
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				// the Bloom filter contains the hashes of the (plain encoded) distinct values
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
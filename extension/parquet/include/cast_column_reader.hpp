@@ -45,6 +45,10 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void SetPageIndex(unique_ptr<OffsetIndex> offset_index, const vector<ParquetRowRange> &skipped_ranges) override {
+		child_reader->SetPageIndex(std::move(offset_index), skipped_ranges);
+	}
 };
 
 } // namespace duckdb
@@ -32,12 +32,19 @@ using duckdb_apache::thrift::protocol::TProtocol;
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
 typedef std::bitset<STANDARD_VECTOR_SIZE> parquet_filter_t;
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 class ColumnReader {
 public:
 	ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -67,6 +74,9 @@ public:
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
+	// set the offset index of the current column chunk, which allows pending skips to jump over pages. Pages that
+	// only contain skipped rows are not registered for prefetching
+	virtual void SetPageIndex(unique_ptr<OffsetIndex> offset_index, const vector<ParquetRowRange> &skipped_ranges);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
@@ -151,6 +161,11 @@ private:
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
 
+	//! The offset index of the current column chunk (if any)
+	unique_ptr<OffsetIndex> offset_index;
+	//! Whether or not a page of the offset index is skipped entirely
+	vector<bool> skipped_pages;
+
 	shared_ptr<ResizeableBuffer> block;
 
 	ResizeableBuffer compressed_buffer;
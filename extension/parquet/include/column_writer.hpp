@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of (a page of) the same column into these statistics
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
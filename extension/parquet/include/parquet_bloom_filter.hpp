@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "resizable_buffer.hpp"
+
+namespace duckdb {
+
+//! ParquetBloomFilter is a split block Bloom filter as defined by the Parquet format. The filter consists of blocks of
+//! eight 32-bit words, every value sets one bit in each of the words of a single block. Values are hashed with XXH64
+//! over their plain encoding.
+class ParquetBloomFilter {
+public:
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 8 * sizeof(uint32_t);
+	//! The minimum and maximum size of a Bloom filter in bytes
+	static constexpr const idx_t MIN_FILTER_SIZE = BLOCK_SIZE;
+	static constexpr const idx_t MAX_FILTER_SIZE = 128 * 1024 * 1024;
+
+public:
+	//! Creates an empty Bloom filter that is sized for the given number of distinct values and false positive ratio
+	ParquetBloomFilter(Allocator &allocator, idx_t distinct_count, double false_positive_ratio);
+	//! Creates a Bloom filter from a serialized bitset
+	explicit ParquetBloomFilter(unique_ptr<ResizeableBuffer> data);
+
+public:
+	//! Hashes a plain encoded value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+
+	void FilterInsert(uint64_t hash);
+	//! Returns false if the value with the given hash is definitely not in the filter
+	bool FilterCheck(uint64_t hash) const;
+
+	const ResizeableBuffer &Get() const {
+		return *data;
+	}
+
+private:
+	uint32_t *GetBlock(uint64_t hash) const;
+
+private:
+	//! The bitset of the filter
+	unique_ptr<ResizeableBuffer> data;
+	//! The number of blocks in the filter
+	idx_t block_count;
+};
+
+} // namespace duckdb
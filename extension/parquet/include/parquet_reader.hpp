@@ -63,6 +63,10 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Sorted ranges of rows of the current row group that can be skipped according to the page index
+	vector<ParquetRowRange> skipped_ranges;
+	idx_t skipped_range_idx = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -159,9 +163,16 @@ private:
 	const duckdb_parquet::format::RowGroup &GetGroup(ParquetReaderScanState &state);
 	uint64_t GetGroupCompressedSize(ParquetReaderScanState &state);
 	idx_t GetGroupOffset(ParquetReaderScanState &state);
+	static idx_t GetGroupOffset(const duckdb_parquet::format::RowGroup &group);
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
+	static uint64_t GetGroupSpan(const duckdb_parquet::format::RowGroup &group);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Checks whether the filter can be true for any value in the Bloom filter of the column chunk
+	bool CheckBloomFilter(ParquetReaderScanState &state, const ColumnReader &column_reader,
+	                      const duckdb_parquet::format::ColumnChunk &column_chunk, const TableFilter &filter);
+	//! Uses the page index of the filtered columns to find ranges of rows in the current row group we can skip
+	void PrepareRowGroupPageIndex(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
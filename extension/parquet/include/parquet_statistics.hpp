@@ -18,6 +18,9 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the statistics of a column chunk (or of a page in the column index) of the given type
+	static unique_ptr<BaseStatistics> TransformStatistics(const LogicalType &type, const SchemaElement &s_ele,
+	                                                      const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
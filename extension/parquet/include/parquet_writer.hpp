@@ -19,6 +19,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
@@ -36,6 +37,15 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index and Bloom filter of a column chunk, these are written after all row groups
+struct ParquetColumnChunkIndex {
+	idx_t row_group_idx = 0;
+	idx_t column_idx = 0;
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -65,7 +75,8 @@ public:
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level);
+	              optional_idx compression_level, bool write_page_index = false, bool write_bloom_filter = false,
+	              double bloom_filter_false_positive_ratio = 0.01);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -98,6 +109,18 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
+	bool WriteBloomFilter() const {
+		return write_bloom_filter;
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
+	//! Adds the page index/Bloom filter of a column chunk of the row group that is currently being flushed
+	//! (must be called while holding the lock in FlushRowGroup)
+	void AddColumnChunkIndex(ParquetColumnChunkIndex chunk_index);
 
 	static CopyTypeSupport TypeIsSupported(const LogicalType &type);
 
@@ -107,6 +130,8 @@ public:
 private:
 	static CopyTypeSupport DuckDBTypeToParquetTypeInternal(const LogicalType &duckdb_type,
 	                                                       duckdb_parquet::format::Type::type &type);
+	void WriteColumnChunkIndexes();
+
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
@@ -115,6 +140,9 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	bool write_page_index;
+	bool write_bloom_filter;
+	double bloom_filter_false_positive_ratio;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -122,6 +150,7 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<ParquetColumnChunkIndex> column_chunk_indexes;
 };
 
 } // namespace duckdb
@@ -105,6 +105,12 @@ struct ReadAheadBuffer {
 
 	// Prefetch all read heads
 	void Prefetch() {
+		// let the file system fetch all read heads concurrently before we read them one by one
+		for (auto &read_head : read_heads) {
+			if (read_head.GetEnd() <= handle.GetFileSize()) {
+				handle.ReadAhead(read_head.location, read_head.size);
+			}
+		}
 		for (auto &read_head : read_heads) {
 			read_head.Allocate(allocator);
 
@@ -0,0 +1,63 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+//! The salts that are used to set the bits in the words of a block (see the Parquet specification)
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+static idx_t OptimalBloomFilterSize(idx_t distinct_count, double false_positive_ratio) {
+	// the number of bits needed for the given false positive ratio, with eight bits that are set per value
+	auto bit_count = -8.0 * static_cast<double>(distinct_count) / std::log(1 - std::pow(false_positive_ratio, 1.0 / 8));
+	auto byte_count = static_cast<idx_t>(bit_count / 8);
+	return NextPowerOfTwo(MinValue<idx_t>(MaxValue<idx_t>(byte_count, ParquetBloomFilter::MIN_FILTER_SIZE),
+	                                      ParquetBloomFilter::MAX_FILTER_SIZE));
+}
+
+ParquetBloomFilter::ParquetBloomFilter(Allocator &allocator, idx_t distinct_count, double false_positive_ratio) {
+	auto filter_size = OptimalBloomFilterSize(distinct_count, false_positive_ratio);
+	data = make_uniq<ResizeableBuffer>(allocator, filter_size);
+	data->zero();
+	block_count = filter_size / BLOCK_SIZE;
+}
+
+ParquetBloomFilter::ParquetBloomFilter(unique_ptr<ResizeableBuffer> data_p) : data(std::move(data_p)) {
+	D_ASSERT(data->len % BLOCK_SIZE == 0);
+	block_count = data->len / BLOCK_SIZE;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+uint32_t *ParquetBloomFilter::GetBlock(uint64_t hash) const {
+	// the upper 32 bits of the hash select the block
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	return reinterpret_cast<uint32_t *>(data->ptr + block_idx * BLOCK_SIZE);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block = GetBlock(hash);
+	// the lower 32 bits of the hash select the bits within the block
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block = GetBlock(hash);
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace duckdb
@@ -162,6 +162,13 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! Whether or not to write the page index (column index and offset index)
+	bool write_page_index = false;
+	//! Whether or not to write Bloom filters for dictionary encoded columns
+	bool write_bloom_filter = false;
+	//! The target false positive ratio of the Bloom filters
+	double bloom_filter_false_positive_ratio = 0.01;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -1138,10 +1145,26 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			bind_data->dictionary_compression_ratio_threshold = val;
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index =
+			    option.second.empty() || BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "write_bloom_filter") {
+			bind_data->write_bloom_filter =
+			    option.second.empty() || BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->encryption_config && (bind_data->write_page_index || bind_data->write_bloom_filter)) {
+		throw BinderException("WRITE_PAGE_INDEX and WRITE_BLOOM_FILTER are not supported in combination with "
+		                      "ENCRYPTION_CONFIG");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1166,7 +1189,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	global_state->writer = make_uniq<ParquetWriter>(
 	    fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
 	    parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata, parquet_bind.encryption_config,
-	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level);
+	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level,
+	    parquet_bind.write_page_index, parquet_bind.write_bloom_filter, parquet_bind.bloom_filter_false_positive_ratio);
 	return std::move(global_state);
 }
 
@@ -1288,6 +1312,10 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(108, "dictionary_compression_ratio_threshold",
 	                         bind_data.dictionary_compression_ratio_threshold);
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
+	serializer.WritePropertyWithDefault<bool>(110, "write_page_index", bind_data.write_page_index, false);
+	serializer.WritePropertyWithDefault<bool>(111, "write_bloom_filter", bind_data.write_bloom_filter, false);
+	serializer.WritePropertyWithDefault<double>(112, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1304,6 +1332,10 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	deserializer.ReadPropertyWithDefault<double>(108, "dictionary_compression_ratio_threshold",
 	                                             data->dictionary_compression_ratio_threshold, 1.0);
 	deserializer.ReadPropertyWithDefault<optional_idx>(109, "compression_level", data->compression_level);
+	deserializer.ReadPropertyWithDefault<bool>(110, "write_page_index", data->write_page_index, false);
+	deserializer.ReadPropertyWithDefault<bool>(111, "write_bloom_filter", data->write_bloom_filter, false);
+	deserializer.ReadPropertyWithDefault<double>(112, "bloom_filter_false_positive_ratio",
+	                                             data->bloom_filter_false_positive_ratio, 0.01);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
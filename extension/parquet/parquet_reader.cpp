@@ -6,6 +6,7 @@
 #include "column_reader.hpp"
 #include "duckdb.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -38,11 +39,14 @@
 
 namespace duckdb {
 
+using duckdb_parquet::format::BloomFilterHeader;
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
@@ -603,7 +607,10 @@ uint64_t ParquetReader::GetGroupCompressedSize(ParquetReaderScanState &state) {
 }
 
 uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+	return GetGroupSpan(GetGroup(state));
+}
+
+uint64_t ParquetReader::GetGroupSpan(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 	idx_t max_offset = NumericLimits<idx_t>::Minimum();
 
@@ -626,7 +633,10 @@ uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
 }
 
 idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+	return GetGroupOffset(GetGroup(state));
+}
+
+idx_t ParquetReader::GetGroupOffset(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 
 	for (auto &column_chunk : group.columns) {
@@ -659,6 +669,10 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			auto prune_result = filter.CheckStatistics(*stats);
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
+			} else if (!parquet_options.encryption_config && column_reader->FileIdx() < group.columns.size() &&
+			           group.columns[column_reader->FileIdx()].meta_data.__isset.bloom_filter_offset &&
+			           !CheckBloomFilter(state, *column_reader, group.columns[column_reader->FileIdx()], filter)) {
+				skip_chunk = true;
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -672,6 +686,216 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+//! Computes the hash of a constant in the same way as the Bloom filter does for the (plain encoded) column values
+static bool GetBloomFilterHash(const ColumnReader &column_reader, const Value &constant, uint64_t &hash) {
+	if (constant.IsNull() || constant.type() != column_reader.Type()) {
+		return false;
+	}
+	auto parquet_type = column_reader.Schema().type;
+	switch (constant.type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE: {
+		if (parquet_type != Type::INT32) {
+			return false;
+		}
+		auto value = constant.type().id() == LogicalTypeId::DATE ? constant.GetValue<date_t>().days
+		                                                          : constant.GetValue<int32_t>();
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER: {
+		if (parquet_type != Type::INT32) {
+			return false;
+		}
+		auto value = constant.GetValue<uint32_t>();
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UBIGINT: {
+		if (parquet_type != Type::INT64) {
+			return false;
+		}
+		auto value = constant.type().id() == LogicalTypeId::BIGINT ? constant.GetValue<int64_t>()
+		                                                            : int64_t(constant.GetValue<uint64_t>());
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (parquet_type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &value = StringValue::Get(constant);
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(value.c_str()), value.size());
+		return true;
+	}
+	default:
+		// the plain encoding of other types does not match their in-memory representation
+		return false;
+	}
+}
+
+static bool BloomFilterMayMatch(const ColumnReader &column_reader, const ParquetBloomFilter &bloom_filter,
+                                const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !GetBloomFilterHash(column_reader, constant_filter.constant, hash)) {
+			return true;
+		}
+		return bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterMayMatch(column_reader, bloom_filter, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// e.g. an IN list: we can only skip if none of the values are in the Bloom filter
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterMayMatch(column_reader, bloom_filter, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
+bool ParquetReader::CheckBloomFilter(ParquetReaderScanState &state, const ColumnReader &column_reader,
+                                     const ColumnChunk &column_chunk, const TableFilter &filter) {
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.SetLocation(NumericCast<idx_t>(column_chunk.meta_data.bloom_filter_offset));
+
+	BloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED ||
+	    header.numBytes <= 0 || header.numBytes % ParquetBloomFilter::BLOCK_SIZE != 0) {
+		// we do not know how to read this Bloom filter
+		return true;
+	}
+	auto bitset = make_uniq<ResizeableBuffer>(allocator, NumericCast<idx_t>(header.numBytes));
+	ReadData(*state.thrift_file_proto, bitset->ptr, NumericCast<uint32_t>(header.numBytes));
+	ParquetBloomFilter bloom_filter(std::move(bitset));
+	return BloomFilterMayMatch(column_reader, bloom_filter, filter);
+}
+
+void ParquetReader::PrepareRowGroupPageIndex(ParquetReaderScanState &state) {
+	auto &group = GetGroup(state);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+
+	// find the rows that can be skipped based on the page statistics of the filtered columns
+	vector<bool> skip_row_marker;
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto column_id = reader_data.column_ids[filter_entry.index];
+		if (reader_data.cast_map.find(column_id) != reader_data.cast_map.end() ||
+		    (parquet_options.file_row_number && column_id == file_row_number_idx)) {
+			continue;
+		}
+		auto &column_reader = *root_reader.GetChildReader(column_id);
+		if (column_reader.MaxRepeat() > 0 || column_reader.Type().IsNested() ||
+		    column_reader.FileIdx() >= group.columns.size()) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader.FileIdx()];
+		if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+			continue;
+		}
+		ColumnIndex column_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+		Read(column_index, *state.thrift_file_proto);
+		OffsetIndex offset_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		Read(offset_index, *state.thrift_file_proto);
+
+		auto &page_locations = offset_index.page_locations;
+		if (column_index.null_pages.size() != page_locations.size() ||
+		    column_index.min_values.size() != page_locations.size() ||
+		    column_index.max_values.size() != page_locations.size()) {
+			continue;
+		}
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			if (column_index.null_pages[page_idx]) {
+				// a page with only NULL values: there are no statistics to check
+				continue;
+			}
+			Statistics page_stats;
+			page_stats.__set_min_value(column_index.min_values[page_idx]);
+			page_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			auto stats =
+			    ParquetStatisticsUtils::TransformStatistics(column_reader.Type(), column_reader.Schema(), page_stats);
+			if (!stats || filter_col.second->CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			auto page_end = page_idx + 1 < page_locations.size()
+			                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			                    : group_rows;
+			if (skip_row_marker.empty()) {
+				skip_row_marker.resize(group_rows, false);
+			}
+			for (idx_t row_idx = page_start; row_idx < MinValue(page_end, group_rows); row_idx++) {
+				skip_row_marker[row_idx] = true;
+			}
+		}
+	}
+	if (skip_row_marker.empty()) {
+		return;
+	}
+	// convert the skipped rows into ranges
+	for (idx_t row_idx = 0; row_idx < group_rows; row_idx++) {
+		if (!skip_row_marker[row_idx]) {
+			continue;
+		}
+		if (!state.skipped_ranges.empty() && state.skipped_ranges.back().end == row_idx) {
+			state.skipped_ranges.back().end++;
+		} else {
+			state.skipped_ranges.push_back(ParquetRowRange {row_idx, row_idx + 1});
+		}
+	}
+
+	// pass the offset indexes to the column readers so they can jump over the skipped pages
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_id = reader_data.column_ids[col_idx];
+		auto &column_reader = *root_reader.GetChildReader(column_id);
+		if (column_reader.MaxRepeat() > 0 || column_reader.Type().IsNested() ||
+		    (parquet_options.file_row_number && column_id == file_row_number_idx)) {
+			continue;
+		}
+		auto file_idx = column_reader.FileIdx();
+		if (file_idx >= group.columns.size() || !group.columns[file_idx].__isset.offset_index_offset) {
+			continue;
+		}
+		auto offset_index = make_uniq<OffsetIndex>();
+		trans.SetLocation(NumericCast<idx_t>(group.columns[file_idx].offset_index_offset));
+		Read(*offset_index, *state.thrift_file_proto);
+		column_reader.SetPageIndex(std::move(offset_index), state.skipped_ranges);
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -911,6 +1135,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
 		trans.ClearPrefetch();
 		state.current_group_prefetched = false;
+		state.skipped_ranges.clear();
+		state.skipped_range_idx = 0;
 
 		if ((idx_t)state.current_group == state.group_idx_list.size()) {
 			state.finished = true;
@@ -928,6 +1154,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		auto &group = GetGroup(state);
+		if (reader_data.filters && !parquet_options.encryption_config && state.group_offset != (idx_t)group.num_rows) {
+			PrepareRowGroupPageIndex(state);
+		}
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
@@ -949,6 +1178,11 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 					}
 					state.current_group_prefetched = true;
 				}
+				// hint the next row group of this scan so it is fetched while we process the current one
+				if ((idx_t)state.current_group + 1 < state.group_idx_list.size()) {
+					auto &next_group = GetFileMetadata()->row_groups[state.group_idx_list[state.current_group + 1]];
+					state.file_handle->ReadAhead(GetGroupOffset(next_group), GetGroupSpan(next_group));
+				}
 			} else {
 				// lazy fetching is when all tuples in a column can be skipped. With lazy fetching the buffer is only
 				// fetched on the first read to that buffer.
@@ -977,7 +1211,33 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// skip the rows that the page index told us cannot match the filters
+	auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+	auto chunk_end = group_rows;
+	if (state.skipped_range_idx < state.skipped_ranges.size()) {
+		auto &range = state.skipped_ranges[state.skipped_range_idx];
+		if (range.start <= state.group_offset) {
+			state.skipped_range_idx++;
+			if (range.end >= group_rows) {
+				// the rest of the row group is skipped: move on to the next one
+				state.group_offset = group_rows;
+				result.SetCardinality(0);
+				return true;
+			}
+			auto skip_count = range.end - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset = range.end;
+		}
+		if (state.skipped_range_idx < state.skipped_ranges.size()) {
+			chunk_end = MinValue(chunk_end, state.skipped_ranges[state.skipped_range_idx].start);
+		}
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, chunk_end - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1001,8 +1261,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
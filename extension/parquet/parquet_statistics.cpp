@@ -286,11 +286,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
-
-	auto &type = reader.Type();
-	auto &s_ele = reader.Schema();
+	return TransformStatistics(reader.Type(), reader.Schema(), column_chunk.meta_data.statistics);
+}
 
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const LogicalType &type, const SchemaElement &s_ele,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	switch (type.id()) {
 	case LogicalTypeId::UTINYINT:
 	case LogicalTypeId::USMALLINT:
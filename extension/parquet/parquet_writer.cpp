@@ -353,10 +353,14 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
-                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p)
+                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
+                             bool write_page_index_p, bool write_bloom_filter_p,
+                             double bloom_filter_false_positive_ratio_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
-      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p) {
+      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
+      write_page_index(write_page_index_p), write_bloom_filter(write_bloom_filter_p),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -554,7 +558,60 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::AddColumnChunkIndex(ParquetColumnChunkIndex chunk_index) {
+	// the row group is appended to the file meta data after all of its columns have been written
+	chunk_index.row_group_idx = file_meta_data.row_groups.size();
+	column_chunk_indexes.push_back(std::move(chunk_index));
+}
+
+void ParquetWriter::WriteColumnChunkIndexes() {
+	// the column indexes and offset indexes are each written contiguously, so readers can fetch them in one go
+	for (auto &chunk_index : column_chunk_indexes) {
+		if (!chunk_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[chunk_index.row_group_idx].columns[chunk_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*chunk_index.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &chunk_index : column_chunk_indexes) {
+		if (!chunk_index.offset_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[chunk_index.row_group_idx].columns[chunk_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*chunk_index.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &chunk_index : column_chunk_indexes) {
+		if (!chunk_index.bloom_filter) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[chunk_index.row_group_idx].columns[chunk_index.column_idx];
+		auto &bitset = chunk_index.bloom_filter->Get();
+
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bitset.len);
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+		auto offset = writer->GetTotalWritten();
+		Write(header);
+		WriteData(bitset.ptr, NumericCast<uint32_t>(bitset.len));
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	column_chunk_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	// the page index and Bloom filters are written between the last row group and the footer
+	WriteColumnChunkIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
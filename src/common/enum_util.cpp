@@ -1194,6 +1194,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1239,6 +1241,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -4328,6 +4333,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::JOIN_FILTER_PUSHDOWN:
+		return "JOIN_FILTER_PUSHDOWN";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -4391,6 +4398,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "JOIN_FILTER_PUSHDOWN")) {
+		return OptimizerType::JOIN_FILTER_PUSHDOWN;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -4792,6 +4802,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -4848,6 +4860,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -4964,6 +4978,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -5048,6 +5065,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INDEX_JOIN")) {
+		return PhysicalOperatorType::INDEX_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -6753,6 +6773,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6778,6 +6800,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -366,6 +366,11 @@ bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes
 	return false;
 }
 
+bool FileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// This is not a required method. Derived FileSystems may optionally override/implement.
+	return false;
+}
+
 void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
@@ -556,6 +561,10 @@ bool FileHandle::Trim(idx_t offset_bytes, idx_t length_bytes) {
 	return file_system.Trim(*this, offset_bytes, length_bytes);
 }
 
+bool FileHandle::ReadAhead(idx_t location, idx_t nr_bytes) {
+	return file_system.ReadAhead(*this, location, nr_bytes);
+}
+
 int64_t FileHandle::Write(void *buffer, idx_t nr_bytes) {
 	return file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes));
 }
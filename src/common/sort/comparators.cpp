@@ -37,16 +37,24 @@ int Comparators::CompareTuple(const SBScanState &left, const SBScanState &right,
 	int comp_res = 0;
 	data_ptr_t l_ptr_offset = l_ptr;
 	data_ptr_t r_ptr_offset = r_ptr;
+	idx_t comp_size = 0;
 	for (idx_t col_idx = 0; col_idx < sort_layout.column_count; col_idx++) {
-		comp_res = FastMemcmp(l_ptr_offset, r_ptr_offset, sort_layout.column_sizes[col_idx]);
+		// The normalized keys of constant size columns can be compared as a whole, so we compare all adjacent columns
+		// up to the next variable size column (or the last column) with a single memcmp
+		comp_size += sort_layout.column_sizes[col_idx];
+		if (sort_layout.constant_size[col_idx] && col_idx < sort_layout.column_count - 1) {
+			continue;
+		}
+		comp_res = FastMemcmp(l_ptr_offset, r_ptr_offset, comp_size);
 		if (comp_res == 0 && !sort_layout.constant_size[col_idx]) {
 			comp_res = BreakBlobTie(col_idx, left, right, sort_layout, external_sort);
 		}
 		if (comp_res != 0) {
 			break;
 		}
-		l_ptr_offset += sort_layout.column_sizes[col_idx];
-		r_ptr_offset += sort_layout.column_sizes[col_idx];
+		l_ptr_offset += comp_size;
+		r_ptr_offset += comp_size;
+		comp_size = 0;
 	}
 	return comp_res;
 }
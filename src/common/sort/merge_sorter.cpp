@@ -5,7 +5,8 @@
 namespace duckdb {
 
 MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
-    : state(state), buffer_manager(buffer_manager), sort_layout(state.sort_layout) {
+    : state(state), buffer_manager(buffer_manager), sort_layout(state.sort_layout), result(nullptr), pair_idx(0),
+      partition_idx(0), l_offset(0), r_offset(0), l_bound(0), r_bound(0), l_end(0), r_end(0) {
 }
 
 void MergeSorter::PerformInMergeRound() {
@@ -17,7 +18,14 @@ void MergeSorter::PerformInMergeRound() {
 			}
 			GetNextPartition();
 		}
+		// The boundaries of a partition only depend on its position in the output, so they can be computed
+		// (and the partition can be merged) in parallel with the other partitions, without holding the lock
+		SlicePartition();
 		MergePartition();
+		{
+			lock_guard<mutex> pair_guard(state.lock);
+			FinishPartition();
+		}
 	}
 }
 
@@ -82,51 +90,89 @@ void MergeSorter::MergePartition() {
 }
 
 void MergeSorter::GetNextPartition() {
+	pair_idx = state.pair_idx;
+	auto &pair_state = state.pair_states[pair_idx];
+	partition_idx = pair_state.partition_idx++;
 	// Create result block
-	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
-	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	auto &result_block = state.sorted_blocks_temp[pair_idx][partition_idx];
+	result_block = make_uniq<SortedBlock>(buffer_manager, state);
+	result = result_block.get();
 	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
-	const idx_t l_count = left_block.Count();
-	const idx_t r_count = right_block.Count();
+	auto &left_block = *state.sorted_blocks[pair_idx * 2];
+	auto &right_block = *state.sorted_blocks[pair_idx * 2 + 1];
+	// Rows before (l_finished, r_finished) have already been merged, take a reference to the remaining data
+	// This also releases the blocks that are no longer needed
+	idx_t l_entry_idx;
+	idx_t r_entry_idx;
+	left_input = left_block.CreateSlice(pair_state.l_finished, left_block.Count(), l_entry_idx);
+	right_input = right_block.CreateSlice(pair_state.r_finished, right_block.Count(), r_entry_idx);
+	l_offset = pair_state.l_finished - l_entry_idx;
+	r_offset = pair_state.r_finished - r_entry_idx;
+	l_bound = l_entry_idx;
+	r_bound = r_entry_idx;
+	// Update global state
+	if (pair_state.partition_idx == pair_state.partition_count) {
+		// Delete references to previous pair
+		state.sorted_blocks[pair_idx * 2] = nullptr;
+		state.sorted_blocks[pair_idx * 2 + 1] = nullptr;
+		// Advance pair
+		state.pair_idx++;
+	}
+}
+
+void MergeSorter::SlicePartition() {
 	// Initialize left and right reader
 	left = make_uniq<SBScanState>(buffer_manager, state);
 	right = make_uniq<SBScanState>(buffer_manager, state);
+	left->sb = left_input.get();
+	right->sb = right_input.get();
 	// Compute the work that this thread must do using Merge Path
-	idx_t l_end;
-	idx_t r_end;
-	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
-		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
-		GetIntersection(intersection, l_end, r_end);
-		D_ASSERT(l_end <= l_count);
-		D_ASSERT(r_end <= r_count);
-		D_ASSERT(intersection == l_end + r_end);
+	const idx_t l_count = left_input->Count();
+	const idx_t r_count = right_input->Count();
+	const idx_t offset = l_offset + r_offset;
+	const idx_t diagonal_start = partition_idx * state.block_capacity - offset;
+	const idx_t diagonal_end = MinValue(diagonal_start + state.block_capacity, l_count + r_count);
+	idx_t l_start;
+	idx_t r_start;
+	GetIntersection(diagonal_start, l_start, r_start);
+	D_ASSERT(diagonal_start == l_start + r_start);
+	l_bound = l_start;
+	r_bound = r_start;
+	idx_t l_end_idx;
+	idx_t r_end_idx;
+	if (partition_idx + 1 == state.pair_states[pair_idx].partition_count) {
+		l_end_idx = l_count;
+		r_end_idx = r_count;
 	} else {
-		l_end = l_count;
-		r_end = r_count;
+		GetIntersection(diagonal_end, l_end_idx, r_end_idx);
 	}
+	D_ASSERT(l_end_idx <= l_count);
+	D_ASSERT(r_end_idx <= r_count);
+	D_ASSERT(diagonal_end == l_end_idx + r_end_idx);
+	l_end = l_offset + l_end_idx;
+	r_end = r_offset + r_end_idx;
 	// Create slices of the data that this thread must merge
 	left->SetIndices(0, 0);
 	right->SetIndices(0, 0);
-	left_input = left_block.CreateSlice(state.l_start, l_end, left->entry_idx);
-	right_input = right_block.CreateSlice(state.r_start, r_end, right->entry_idx);
+	auto l_remaining = left_input->CreateSlice(l_start, l_end_idx, left->entry_idx);
+	auto r_remaining = right_input->CreateSlice(r_start, r_end_idx, right->entry_idx);
+	left_input = std::move(l_remaining);
+	right_input = std::move(r_remaining);
 	left->sb = left_input.get();
 	right->sb = right_input.get();
-	state.l_start = l_end;
-	state.r_start = r_end;
-	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity || (l_end == l_count && r_end == r_count));
-	// Update global state
-	if (state.l_start == l_count && state.r_start == r_count) {
-		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
-		// Advance pair
-		state.pair_idx++;
-		state.l_start = 0;
-		state.r_start = 0;
+	D_ASSERT(left->Remaining() + right->Remaining() == diagonal_end - diagonal_start);
+}
+
+void MergeSorter::FinishPartition() {
+	auto &pair_state = state.pair_states[pair_idx];
+	pair_state.partition_done[partition_idx] = true;
+	pair_state.partition_ends[partition_idx] = make_pair(l_end, r_end);
+	// Advance past all partitions that have been merged, the next partition that is claimed can release their data
+	while (pair_state.finished_count < pair_state.partition_count &&
+	       pair_state.partition_done[pair_state.finished_count]) {
+		pair_state.l_finished = pair_state.partition_ends[pair_state.finished_count].first;
+		pair_state.r_finished = pair_state.partition_ends[pair_state.finished_count].second;
+		pair_state.finished_count++;
 	}
 }
 
@@ -135,10 +181,10 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	D_ASSERT(r_idx < r.sb->Count());
 
 	// Easy comparison using the previous result (intersections must increase monotonically)
-	if (l_idx < state.l_start) {
+	if (l_idx < l_bound) {
 		return -1;
 	}
-	if (r_idx < state.r_start) {
+	if (r_idx < r_bound) {
 		return 1;
 	}
 
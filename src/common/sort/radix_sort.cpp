@@ -106,31 +106,57 @@ static void ComputeTies(data_ptr_t dataptr, const idx_t &count, const idx_t &col
 	}
 }
 
+//! Collects the counts of every byte of the key in a single pass over the data
+template <idx_t SORTING_SIZE>
+static void CountRadixBytes(data_ptr_t offset_ptr, const idx_t &count, const idx_t &row_width,
+                            idx_t counts[][SortConstants::VALUES_PER_RADIX]) {
+	for (idx_t i = 0; i < count; i++) {
+		for (idx_t byte_idx = 0; byte_idx < SORTING_SIZE; byte_idx++) {
+			counts[byte_idx][offset_ptr[byte_idx]]++;
+		}
+		offset_ptr += row_width;
+	}
+}
+
 //! Textbook LSD radix sort
 void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                   const idx_t &row_width, const idx_t &sorting_size) {
+	D_ASSERT(sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD);
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate(count * row_width);
 	bool swap = false;
 
-	idx_t counts[SortConstants::VALUES_PER_RADIX];
+	// Reordering the rows does not change the counts of a byte, so we can collect the counts of all bytes upfront,
+	// rather than reading the data once more for every byte
+	idx_t counts[SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD][SortConstants::VALUES_PER_RADIX];
+	memset(counts, 0, sizeof(counts));
+	switch (sorting_size) {
+	case 1:
+		CountRadixBytes<1>(dataptr + col_offset, count, row_width, counts);
+		break;
+	case 2:
+		CountRadixBytes<2>(dataptr + col_offset, count, row_width, counts);
+		break;
+	case 3:
+		CountRadixBytes<3>(dataptr + col_offset, count, row_width, counts);
+		break;
+	case 4:
+		CountRadixBytes<4>(dataptr + col_offset, count, row_width, counts);
+		break;
+	default:
+		throw InternalException("Unsupported sorting size for LSD radix sort");
+	}
+
 	for (idx_t r = 1; r <= sorting_size; r++) {
-		// Init counts to 0
-		memset(counts, 0, sizeof(counts));
+		auto &byte_counts = counts[sorting_size - r];
 		// Const some values for convenience
 		const data_ptr_t source_ptr = swap ? temp_block.get() : dataptr;
 		const data_ptr_t target_ptr = swap ? dataptr : temp_block.get();
 		const idx_t offset = col_offset + sorting_size - r;
-		// Collect counts
-		data_ptr_t offset_ptr = source_ptr + offset;
-		for (idx_t i = 0; i < count; i++) {
-			counts[*offset_ptr]++;
-			offset_ptr += row_width;
-		}
 		// Compute offsets from counts
-		idx_t max_count = counts[0];
+		idx_t max_count = byte_counts[0];
 		for (idx_t val = 1; val < SortConstants::VALUES_PER_RADIX; val++) {
-			max_count = MaxValue<idx_t>(max_count, counts[val]);
-			counts[val] = counts[val] + counts[val - 1];
+			max_count = MaxValue<idx_t>(max_count, byte_counts[val]);
+			byte_counts[val] = byte_counts[val] + byte_counts[val - 1];
 		}
 		if (max_count == count) {
 			continue;
@@ -138,7 +164,7 @@ void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, cons
 		// Re-order the data in temporary array
 		data_ptr_t row_ptr = source_ptr + (count - 1) * row_width;
 		for (idx_t i = 0; i < count; i++) {
-			idx_t &radix_offset = --counts[*(row_ptr + offset)];
+			idx_t &radix_offset = --byte_counts[*(row_ptr + offset)];
 			FastMemcpy(target_ptr + radix_offset * row_width, row_ptr, row_width);
 			row_ptr -= row_width;
 		}
@@ -442,11 +442,18 @@ void GlobalSortState::InitializeMergeRound() {
 	// Init merge path path indices
 	pair_idx = 0;
 	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
-	// Allocate room for merge results
+	// Every pair is split into partitions of block_capacity rows that can be merged independently
+	pair_states.clear();
+	pair_states.resize(num_pairs);
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+		auto &pair_state = pair_states[p_idx];
+		const auto count = sorted_blocks[p_idx * 2]->Count() + sorted_blocks[p_idx * 2 + 1]->Count();
+		pair_state.partition_count = MaxValue<idx_t>((count + block_capacity - 1) / block_capacity, 1);
+		pair_state.partition_done.resize(pair_state.partition_count, false);
+		pair_state.partition_ends.resize(pair_state.partition_count);
+		// Allocate room for merge results
 		sorted_blocks_temp.emplace_back();
+		sorted_blocks_temp.back().resize(pair_state.partition_count);
 	}
 }
 
@@ -457,6 +464,7 @@ void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 		sorted_blocks.back()->AppendSortedBlocks(sorted_block_vector);
 	}
 	sorted_blocks_temp.clear();
+	pair_states.clear();
 	if (odd_one_out) {
 		sorted_blocks.push_back(std::move(odd_one_out));
 		odd_one_out = nullptr;
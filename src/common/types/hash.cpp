@@ -12,12 +12,12 @@ namespace duckdb {
 
 template <>
 hash_t Hash(uint64_t val) {
-	return MurmurHash64(val);
+	return InlineHash(val);
 }
 
 template <>
 hash_t Hash(int64_t val) {
-	return MurmurHash64((uint64_t)val);
+	return InlineHash(val);
 }
 
 template <>
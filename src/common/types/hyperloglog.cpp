@@ -108,6 +108,124 @@ unique_ptr<HyperLogLog> HyperLogLog::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+//===--------------------------------------------------------------------===//
+// Compact HLL representation
+//===--------------------------------------------------------------------===//
+// The compact representation starts with a version byte and an encoding byte:
+// SPARSE is followed by the number of registers that are set (uint16_t) and an (uint16_t, uint8_t) index/value pair
+// for each of these registers, DENSE is followed by all registers, packed in HLL_COMPACT_BITS bits each.
+static constexpr uint8_t HLL_COMPACT_VERSION = 1;
+static constexpr idx_t HLL_COMPACT_HEADER_SIZE = 2 * sizeof(uint8_t);
+static constexpr idx_t HLL_COMPACT_BITS = 6;
+static constexpr idx_t HLL_COMPACT_SPARSE_ENTRY_SIZE = sizeof(uint16_t) + sizeof(uint8_t);
+
+static idx_t GetCompactDenseSize() {
+	return HLL_COMPACT_HEADER_SIZE + (duckdb_hll::get_register_count() * HLL_COMPACT_BITS + 7) / 8;
+}
+
+static idx_t GetCompactSparseSize(idx_t register_count) {
+	return HLL_COMPACT_HEADER_SIZE + sizeof(uint16_t) + register_count * HLL_COMPACT_SPARSE_ENTRY_SIZE;
+}
+
+idx_t HyperLogLog::GetCompactSize() const {
+	const auto register_count = duckdb_hll::get_register_count();
+	idx_t set_count = 0;
+	for (idx_t i = 0; i < register_count; i++) {
+		set_count += GetRegisterInternal(hll, i) != 0;
+	}
+	return MinValue(GetCompactSparseSize(set_count), GetCompactDenseSize());
+}
+
+void HyperLogLog::WriteCompact(data_ptr_t target) const {
+	const auto register_count = duckdb_hll::get_register_count();
+	idx_t set_count = 0;
+	for (idx_t i = 0; i < register_count; i++) {
+		set_count += GetRegisterInternal(hll, i) != 0;
+	}
+
+	target[0] = HLL_COMPACT_VERSION;
+	if (GetCompactSparseSize(set_count) < GetCompactDenseSize()) {
+		target[1] = static_cast<uint8_t>(HLLCompactEncoding::SPARSE);
+		Store<uint16_t>(UnsafeNumericCast<uint16_t>(set_count), target + HLL_COMPACT_HEADER_SIZE);
+		auto entry = target + HLL_COMPACT_HEADER_SIZE + sizeof(uint16_t);
+		for (idx_t i = 0; i < register_count; i++) {
+			const auto value = GetRegisterInternal(hll, i);
+			if (value) {
+				Store<uint16_t>(UnsafeNumericCast<uint16_t>(i), entry);
+				entry[sizeof(uint16_t)] = value;
+				entry += HLL_COMPACT_SPARSE_ENTRY_SIZE;
+			}
+		}
+		return;
+	}
+
+	target[1] = static_cast<uint8_t>(HLLCompactEncoding::DENSE);
+	auto registers = target + HLL_COMPACT_HEADER_SIZE;
+	memset(registers, 0, GetCompactDenseSize() - HLL_COMPACT_HEADER_SIZE);
+	for (idx_t i = 0; i < register_count; i++) {
+		const auto bit = i * HLL_COMPACT_BITS;
+		const auto value = GetRegisterInternal(hll, i);
+		registers[bit / 8] |= UnsafeNumericCast<uint8_t>(value << (bit % 8));
+		if (bit % 8 + HLL_COMPACT_BITS > 8) {
+			registers[bit / 8 + 1] |= UnsafeNumericCast<uint8_t>(value >> (8 - bit % 8));
+		}
+	}
+}
+
+void HyperLogLog::MergeCompact(const_data_ptr_t source, idx_t size) {
+	if (size < HLL_COMPACT_HEADER_SIZE || source[0] != HLL_COMPACT_VERSION) {
+		throw InvalidInputException("Invalid HyperLogLog sketch");
+	}
+
+	const auto register_count = duckdb_hll::get_register_count();
+	const auto max_value = duckdb_hll::get_max_register_value();
+	lock_guard<mutex> guard(lock);
+	switch (HLLCompactEncoding(source[1])) {
+	case HLLCompactEncoding::SPARSE: {
+		if (size < GetCompactSparseSize(0)) {
+			throw InvalidInputException("Invalid HyperLogLog sketch");
+		}
+		const auto set_count = Load<uint16_t>(source + HLL_COMPACT_HEADER_SIZE);
+		if (size != GetCompactSparseSize(set_count)) {
+			throw InvalidInputException("Invalid HyperLogLog sketch");
+		}
+		auto entry = source + HLL_COMPACT_HEADER_SIZE + sizeof(uint16_t);
+		for (idx_t i = 0; i < set_count; i++, entry += HLL_COMPACT_SPARSE_ENTRY_SIZE) {
+			const auto index = Load<uint16_t>(entry);
+			const auto value = entry[sizeof(uint16_t)];
+			if (index >= register_count || value > max_value) {
+				throw InvalidInputException("Invalid HyperLogLog sketch");
+			}
+			MergeRegisterInternal(hll, index, value);
+		}
+		break;
+	}
+	case HLLCompactEncoding::DENSE: {
+		if (size != GetCompactDenseSize()) {
+			throw InvalidInputException("Invalid HyperLogLog sketch");
+		}
+		static constexpr uint16_t REGISTER_MASK = (1 << HLL_COMPACT_BITS) - 1;
+		auto registers = source + HLL_COMPACT_HEADER_SIZE;
+		const auto last_byte = size - HLL_COMPACT_HEADER_SIZE - 1;
+		for (idx_t i = 0; i < register_count; i++) {
+			const auto bit = i * HLL_COMPACT_BITS;
+			uint16_t bits = registers[bit / 8];
+			if (bit / 8 < last_byte) {
+				bits |= uint16_t(registers[bit / 8 + 1]) << 8;
+			}
+			const auto value = UnsafeNumericCast<uint8_t>((bits >> (bit % 8)) & REGISTER_MASK);
+			if (value > max_value) {
+				throw InvalidInputException("Invalid HyperLogLog sketch");
+			}
+			MergeRegisterInternal(hll, i, value);
+		}
+		break;
+	}
+	default:
+		throw InvalidInputException("Invalid HyperLogLog sketch");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Vectorized HLL implementation
 //===--------------------------------------------------------------------===//
@@ -277,6 +277,14 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 	}
 }
 
+void Vector::Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count) {
+	D_ASSERT(dict.GetVectorType() == VectorType::FLAT_VECTOR);
+	D_ASSERT(dict.GetType().InternalType() != PhysicalType::STRUCT);
+	Reference(dict);
+	Slice(sel, count);
+	auxiliary->Cast<VectorChildBuffer>().size = dictionary_size;
+}
+
 void Vector::Initialize(bool zero_data, idx_t capacity) {
 	auxiliary.reset();
 	validity.Reset();
@@ -16,7 +16,7 @@ struct HashOp {
 
 	template <class T>
 	static inline hash_t Operation(T input, bool is_null) {
-		return is_null ? NULL_HASH : duckdb::Hash<T>(input);
+		return is_null ? NULL_HASH : duckdb::InlineHash<T>(input);
 	}
 };
 
@@ -33,11 +33,16 @@ static inline void TightLoopHash(const T *__restrict ldata, hash_t *__restrict r
 			auto idx = sel_vector->get_index(ridx);
 			result_data[ridx] = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
 		}
+	} else if (!HAS_RSEL && !sel_vector->data()) {
+		// Dense input without NULLs: no indirection, so this loop can be auto-vectorized
+		for (idx_t i = 0; i < count; i++) {
+			result_data[i] = duckdb::InlineHash<T>(ldata[i]);
+		}
 	} else {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			result_data[ridx] = duckdb::Hash<T>(ldata[idx]);
+			result_data[ridx] = duckdb::InlineHash<T>(ldata[idx]);
 		}
 	}
 }
@@ -307,11 +312,72 @@ static inline void HashTypeSwitch(Vector &input, Vector &result, const Selection
 	}
 }
 
+//! Whether or not it is cheaper to hash the entries of the dictionary than the rows of the dictionary vector
+static bool HashDictionary(Vector &input, idx_t count) {
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::STRUCT:
+	case PhysicalType::LIST:
+	case PhysicalType::ARRAY:
+		return false;
+	default:
+		break;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	return dictionary_size.IsValid() && dictionary_size.GetIndex() < count;
+}
+
+template <bool HAS_RSEL, bool FIRST_HASH>
+static void DictionaryLoopHash(Vector &input, Vector &hashes, const SelectionVector *rsel, idx_t count) {
+	// hash every entry of the dictionary once
+	auto dictionary_size = DictionaryVector::DictionarySize(input).GetIndex();
+	Vector dictionary_hashes(LogicalType::HASH, dictionary_size);
+	HashTypeSwitch<false>(DictionaryVector::Child(input), dictionary_hashes, nullptr, dictionary_size);
+	dictionary_hashes.Flatten(dictionary_size);
+	auto dictionary_hash_data = FlatVector::GetData<hash_t>(dictionary_hashes);
+
+	// then look up the hashes of the rows through the dictionary codes
+	auto &codes = DictionaryVector::SelVector(input);
+	if (FIRST_HASH) {
+		hashes.SetVectorType(VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = dictionary_hash_data[codes.get_index(ridx)];
+		}
+	} else if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
+		hashes.SetVectorType(VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(constant_hash, dictionary_hash_data[codes.get_index(ridx)]);
+		}
+	} else {
+		D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(hash_data[ridx], dictionary_hash_data[codes.get_index(ridx)]);
+		}
+	}
+}
+
 void VectorOperations::Hash(Vector &input, Vector &result, idx_t count) {
+	if (HashDictionary(input, count)) {
+		DictionaryLoopHash<false, true>(input, result, nullptr, count);
+		return;
+	}
 	HashTypeSwitch<false>(input, result, nullptr, count);
 }
 
 void VectorOperations::Hash(Vector &input, Vector &result, const SelectionVector &sel, idx_t count) {
+	if (HashDictionary(input, count)) {
+		DictionaryLoopHash<true, true>(input, result, &sel, count);
+		return;
+	}
 	HashTypeSwitch<true>(input, result, &sel, count);
 }
 
@@ -330,7 +396,7 @@ static inline void TightLoopCombineHashConstant(const T *__restrict ldata, hash_
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			auto other_hash = duckdb::Hash<T>(ldata[idx]);
+			auto other_hash = duckdb::InlineHash<T>(ldata[idx]);
 			hash_data[ridx] = CombineHashScalar(constant_hash, other_hash);
 		}
 	}
@@ -347,11 +413,15 @@ static inline void TightLoopCombineHash(const T *__restrict ldata, hash_t *__res
 			auto other_hash = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
 			hash_data[ridx] = CombineHashScalar(hash_data[ridx], other_hash);
 		}
+	} else if (!HAS_RSEL && !sel_vector->data()) {
+		for (idx_t i = 0; i < count; i++) {
+			hash_data[i] = CombineHashScalar(hash_data[i], duckdb::InlineHash<T>(ldata[i]));
+		}
 	} else {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			auto other_hash = duckdb::Hash<T>(ldata[idx]);
+			auto other_hash = duckdb::InlineHash<T>(ldata[idx]);
 			hash_data[ridx] = CombineHashScalar(hash_data[ridx], other_hash);
 		}
 	}
@@ -447,10 +517,18 @@ static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const Se
 }
 
 void VectorOperations::CombineHash(Vector &hashes, Vector &input, idx_t count) {
+	if (HashDictionary(input, count)) {
+		DictionaryLoopHash<false, false>(input, hashes, nullptr, count);
+		return;
+	}
 	CombineHashTypeSwitch<false>(hashes, input, nullptr, count);
 }
 
 void VectorOperations::CombineHash(Vector &hashes, Vector &input, const SelectionVector &rsel, idx_t count) {
+	if (HashDictionary(input, count)) {
+		DictionaryLoopHash<true, false>(input, hashes, &rsel, count);
+		return;
+	}
 	CombineHashTypeSwitch<true>(hashes, input, &rsel, count);
 }
 
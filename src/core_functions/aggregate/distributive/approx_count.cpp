@@ -2,6 +2,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 
@@ -123,24 +124,96 @@ AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type)
 	return fun;
 }
 
+static vector<LogicalType> GetApproxCountDistinctTypes() {
+	return {LogicalType::UTINYINT,     LogicalType::USMALLINT, LogicalType::UINTEGER, LogicalType::UBIGINT,
+	        LogicalType::UHUGEINT,     LogicalType::TINYINT,   LogicalType::SMALLINT, LogicalType::BIGINT,
+	        LogicalType::HUGEINT,      LogicalType::FLOAT,     LogicalType::DOUBLE,   LogicalType::TIMESTAMP,
+	        LogicalType::TIMESTAMP_TZ, LogicalType::BLOB,      LogicalType::ANY_PARAMS(LogicalType::VARCHAR, 150)};
+}
+
 AggregateFunctionSet ApproxCountDistinctFun::GetFunctions() {
 	AggregateFunctionSet approx_count("approx_count_distinct");
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UTINYINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::USMALLINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UINTEGER));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UBIGINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UHUGEINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TINYINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::SMALLINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::BIGINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::HUGEINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::FLOAT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::DOUBLE));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TIMESTAMP));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TIMESTAMP_TZ));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::BLOB));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::ANY_PARAMS(LogicalType::VARCHAR, 150)));
+	for (auto &type : GetApproxCountDistinctTypes()) {
+		approx_count.AddFunction(GetApproxCountDistinctFunction(type));
+	}
 	return approx_count;
 }
 
+//===--------------------------------------------------------------------===//
+// HyperLogLog sketches
+//===--------------------------------------------------------------------===//
+// Sketches are stored as BLOBs (in their compact representation), so they can be stored in tables and files and be
+// merged later on, e.g., to roll up the distinct counts of days into the distinct counts of months.
+static string_t WriteHLLSketch(const HyperLogLog *log, Vector &result) {
+	HyperLogLog empty;
+	if (!log) {
+		log = &empty;
+	}
+	auto target = StringVector::EmptyString(result, log->GetCompactSize());
+	log->WriteCompact(data_ptr_cast(target.GetDataWriteable()));
+	target.Finalize();
+	return target;
+}
+
+struct HLLCreateFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		target = WriteHLLSketch(state.log, finalize_data.result);
+	}
+};
+
+struct HLLMergeFunction : public HLLCreateFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		if (!state.log) {
+			state.log = new HyperLogLog();
+		}
+		state.log->MergeCompact(const_data_ptr_cast(input.GetData()), input.GetSize());
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		//	Merging the same sketch again does not change anything
+		OP::template Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+static AggregateFunction GetHLLCreateFunction(const LogicalType &input_type) {
+	auto fun = AggregateFunction(
+	    {input_type}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, HLLCreateFunction>,
+	    ApproxCountDistinctUpdateFunction, AggregateFunction::StateCombine<ApproxDistinctCountState, HLLCreateFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLCreateFunction>,
+	    ApproxCountDistinctSimpleUpdateFunction, nullptr,
+	    AggregateFunction::StateDestroy<ApproxDistinctCountState, HLLCreateFunction>);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+AggregateFunctionSet HllCreateFun::GetFunctions() {
+	AggregateFunctionSet hll_create("hll_create");
+	for (auto &type : GetApproxCountDistinctTypes()) {
+		hll_create.AddFunction(GetHLLCreateFunction(type));
+	}
+	return hll_create;
+}
+
+AggregateFunction HllMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxDistinctCountState, string_t, string_t, HLLMergeFunction>(
+	    LogicalType::BLOB, LogicalType::BLOB);
+}
+
+static void HLLCardinalityFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(), [&](string_t sketch) {
+		HyperLogLog log;
+		log.MergeCompact(const_data_ptr_cast(sketch.GetData()), sketch.GetSize());
+		return UnsafeNumericCast<int64_t>(log.Count());
+	});
+}
+
+ScalarFunction HllCardinalityFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB}, LogicalType::BIGINT, HLLCardinalityFunction);
+}
+
 } // namespace duckdb
@@ -3,6 +3,7 @@
 #include "t_digest.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 
@@ -354,4 +355,127 @@ AggregateFunctionSet ApproxQuantileFun::GetFunctions() {
 	return approx_quantile;
 }
 
+//===--------------------------------------------------------------------===//
+// Quantile sketches
+//===--------------------------------------------------------------------===//
+// Sketches are the (compressed) t-digests of approx_quantile, stored as BLOBs so they can be stored in tables and
+// files and be merged later on, e.g., to compute hourly percentiles from per-minute sketches.
+// A sketch consists of a version byte, the t-digest compression (double), the number of centroids (uint32_t) and
+// the mean and weight (doubles) of each centroid.
+struct QuantileSketch {
+	static constexpr uint8_t VERSION = 1;
+	static constexpr idx_t HEADER_SIZE = sizeof(uint8_t) + sizeof(double) + sizeof(uint32_t);
+	static constexpr idx_t CENTROID_SIZE = 2 * sizeof(double);
+	static constexpr double COMPRESSION = 100;
+
+	static string_t Write(duckdb_tdigest::TDigest *h, Vector &result) {
+		idx_t centroid_count = 0;
+		if (h) {
+			h->compress();
+			centroid_count = h->processed().size();
+		}
+		auto target = StringVector::EmptyString(result, HEADER_SIZE + centroid_count * CENTROID_SIZE);
+		auto ptr = data_ptr_cast(target.GetDataWriteable());
+		*ptr = VERSION;
+		Store<double>(h ? h->compression() : COMPRESSION, ptr + sizeof(uint8_t));
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(centroid_count), ptr + sizeof(uint8_t) + sizeof(double));
+		ptr += HEADER_SIZE;
+		for (idx_t i = 0; i < centroid_count; i++, ptr += CENTROID_SIZE) {
+			auto &centroid = h->processed()[i];
+			Store<double>(centroid.mean(), ptr);
+			Store<double>(centroid.weight(), ptr + sizeof(double));
+		}
+		target.Finalize();
+		return target;
+	}
+
+	static duckdb_tdigest::TDigest Read(const string_t &sketch) {
+		const auto size = sketch.GetSize();
+		auto ptr = const_data_ptr_cast(sketch.GetData());
+		if (size < HEADER_SIZE || *ptr != VERSION) {
+			throw InvalidInputException("Invalid quantile sketch");
+		}
+		const auto compression = Load<double>(ptr + sizeof(uint8_t));
+		const auto centroid_count = Load<uint32_t>(ptr + sizeof(uint8_t) + sizeof(double));
+		if (size != HEADER_SIZE + centroid_count * CENTROID_SIZE || !(compression > 0)) {
+			throw InvalidInputException("Invalid quantile sketch");
+		}
+		ptr += HEADER_SIZE;
+		std::vector<duckdb_tdigest::Centroid> centroids;
+		centroids.reserve(centroid_count);
+		for (idx_t i = 0; i < centroid_count; i++, ptr += CENTROID_SIZE) {
+			const auto mean = Load<double>(ptr);
+			const auto weight = Load<double>(ptr + sizeof(double));
+			if (!Value::DoubleIsFinite(mean) || !(weight > 0) || !Value::DoubleIsFinite(weight) ||
+			    (!centroids.empty() && mean < centroids.back().mean())) {
+				throw InvalidInputException("Invalid quantile sketch");
+			}
+			centroids.emplace_back(mean, weight);
+		}
+		return duckdb_tdigest::TDigest(std::move(centroids), std::vector<duckdb_tdigest::Centroid>(), compression, 0,
+		                               0);
+	}
+};
+
+struct QuantileSketchOperation : public ApproxQuantileOperation {
+	template <class TARGET_TYPE, class STATE>
+	static void Finalize(STATE &state, TARGET_TYPE &target, AggregateFinalizeData &finalize_data) {
+		target = QuantileSketch::Write(state.h, finalize_data.result);
+	}
+};
+
+struct QuantileSketchMergeOperation : public QuantileSketchOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		auto sketch = QuantileSketch::Read(input);
+		if (sketch.processed().empty()) {
+			return;
+		}
+		if (!state.h) {
+			state.h = new duckdb_tdigest::TDigest(QuantileSketch::COMPRESSION);
+		}
+		state.h->merge(&sketch);
+		state.pos++;
+	}
+};
+
+AggregateFunction QuantileSketchAggFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t, QuantileSketchOperation>(
+	    LogicalType::DOUBLE, LogicalType::BLOB);
+}
+
+AggregateFunction QuantileSketchMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, string_t, string_t,
+	                                                   QuantileSketchMergeOperation>(LogicalType::BLOB,
+	                                                                                 LogicalType::BLOB);
+}
+
+static void SketchQuantileFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::ExecuteWithNulls<string_t, double, double>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [&](string_t sketch, double quantile, ValidityMask &mask, idx_t idx) {
+		    if (!(quantile >= 0 && quantile <= 1)) {
+			    throw InvalidInputException("SKETCH_QUANTILE can only take parameters in range [0, 1]");
+		    }
+		    auto h = QuantileSketch::Read(sketch);
+		    if (h.processed().empty()) {
+			    mask.SetInvalid(idx);
+			    return 0.0;
+		    }
+		    return h.quantile(quantile);
+	    });
+}
+
+ScalarFunction SketchQuantileFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::DOUBLE}, LogicalType::DOUBLE, SketchQuantileFunction);
+}
+
 } // namespace duckdb
@@ -178,12 +178,14 @@ struct ModeFunction {
 		if (!target.frequency_map) {
 			// Copy - don't destroy! Otherwise windowing will break.
 			target.frequency_map = new typename STATE::Counts(*source.frequency_map);
+			target.count = source.count;
 			return;
 		}
+		// the rows of the source come after the rows of the target, ties are broken by the first occurrence
 		for (auto &val : *source.frequency_map) {
 			auto &i = (*target.frequency_map)[val.first];
 			i.count += val.second.count;
-			i.first_row = MinValue(i.first_row, val.second.first_row);
+			i.first_row = MinValue(i.first_row, target.count + val.second.first_row);
 		}
 		target.count += source.count;
 	}
@@ -189,6 +189,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION(HashFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HexFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(HistogramFun),
+	DUCKDB_SCALAR_FUNCTION(HllCardinalityFun),
+	DUCKDB_AGGREGATE_FUNCTION_SET(HllCreateFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllMergeFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HoursFun),
 	DUCKDB_SCALAR_FUNCTION(InSearchPathFun),
 	DUCKDB_SCALAR_FUNCTION(InstrFun),
@@ -283,6 +286,8 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_AGGREGATE_FUNCTION_SET_ALIAS(QuantileFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(QuantileContFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(QuantileDiscFun),
+	DUCKDB_AGGREGATE_FUNCTION(QuantileSketchAggFun),
+	DUCKDB_AGGREGATE_FUNCTION(QuantileSketchMergeFun),
 	DUCKDB_SCALAR_FUNCTION_SET(QuarterFun),
 	DUCKDB_SCALAR_FUNCTION(RadiansFun),
 	DUCKDB_SCALAR_FUNCTION(RandomFun),
@@ -317,6 +322,7 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION_SET(SignFun),
 	DUCKDB_SCALAR_FUNCTION_SET(SignBitFun),
 	DUCKDB_SCALAR_FUNCTION(SinFun),
+	DUCKDB_SCALAR_FUNCTION(SketchQuantileFun),
 	DUCKDB_AGGREGATE_FUNCTION(SkewnessFun),
 	DUCKDB_SCALAR_FUNCTION_ALIAS(SplitFun),
 	DUCKDB_SCALAR_FUNCTION(SqrtFun),
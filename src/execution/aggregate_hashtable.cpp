@@ -15,6 +15,21 @@ namespace duckdb {
 
 using ValidityBytes = TupleDataLayout::ValidityBytes;
 
+//! Returns the width of a type that can be hashed and matched inline, or 0 if it can't. Equality of integers is
+//! bitwise and the hash of a 32-bit integer does not depend on its signedness, so only the width matters
+static idx_t GetInlineKeyWidth(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT32:
+	case PhysicalType::UINT32:
+		return sizeof(uint32_t);
+	case PhysicalType::INT64:
+	case PhysicalType::UINT64:
+		return sizeof(uint64_t);
+	default:
+		return 0;
+	}
+}
+
 GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, Allocator &allocator,
                                                      vector<LogicalType> group_types, vector<LogicalType> payload_types,
                                                      const vector<BoundAggregateExpression *> &bindings,
@@ -55,6 +70,13 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 	// Predicates
 	predicates.resize(layout.ColumnCount() - 1, ExpressionType::COMPARE_NOT_DISTINCT_FROM);
 	row_matcher.Initialize(true, layout, predicates);
+
+	// Grouping by one or two integer columns is common enough to warrant its own hashing/matching code
+	const auto group_count = layout.ColumnCount() - 1;
+	inline_keys = group_count == 1 || group_count == 2;
+	for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+		inline_keys = inline_keys && GetInlineKeyWidth(layout.GetTypes()[col_idx]) != 0;
+	}
 }
 
 void GroupedAggregateHashTable::InitializePartitionedData() {
@@ -227,7 +249,7 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	Vector hashes(LogicalType::HASH);
-	groups.Hash(hashes);
+	HashGroups(groups, hashes);
 
 	return AddChunk(groups, hashes, payload, filter);
 }
@@ -246,6 +268,38 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 #endif
 
 	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+	UpdateAggregates(payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+void GroupedAggregateHashTable::AppendChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	if (groups.size() == 0) {
+		return;
+	}
+
+	Vector hashes(LogicalType::HASH);
+	HashGroups(groups, hashes);
+	InitializeGroupChunk(groups, hashes);
+
+	// Every row becomes a new group, the pointer table is not touched
+	partitioned_data->AppendUnified(state.append_state, state.group_chunk);
+	auto &chunk_state = state.append_state.chunk_state;
+	RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+	                                groups.size());
+
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+	const auto &row_sel = state.append_state.reverse_partition_sel;
+	state.addresses.SetVectorType(VectorType::FLAT_VECTOR);
+	const auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		addresses[i] = row_locations[row_sel.get_index(i)];
+	}
+	UpdateAggregates(payload, filter);
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
@@ -275,9 +329,6 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
 		filter_idx++;
 	}
-
-	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -303,6 +354,151 @@ void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &re
 	RowOperations::FinalizeStates(row_state, layout, addresses, result, 0);
 }
 
+void GroupedAggregateHashTable::InitializeGroupChunk(DataChunk &groups, Vector &group_hashes) {
+	if (state.group_chunk.ColumnCount() == 0) {
+		state.group_chunk.InitializeEmpty(layout.GetTypes());
+	}
+	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
+	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
+		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
+	}
+	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes);
+	state.group_chunk.SetCardinality(groups);
+
+	// convert all vectors to unified format
+	auto &chunk_state = state.append_state.chunk_state;
+	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
+	if (!state.group_data) {
+		state.group_data = make_unsafe_uniq_array<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
+	}
+	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
+}
+
+template <class K0>
+static void TemplatedHashInlineKeys(const K0 *__restrict keys0, hash_t *__restrict hashes, const idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		hashes[i] = MurmurHash64(keys0[i]);
+	}
+}
+
+template <class K0, class K1>
+static void TemplatedHashInlineKeys(const K0 *__restrict keys0, const K1 *__restrict keys1,
+                                    hash_t *__restrict hashes, const idx_t count) {
+	// Same as VectorOperations::Hash followed by VectorOperations::CombineHash, but in a single pass
+	for (idx_t i = 0; i < count; i++) {
+		hashes[i] = (MurmurHash64(keys0[i]) * UINT64_C(0xbf58476d1ce4e5b9)) ^ MurmurHash64(keys1[i]);
+	}
+}
+
+template <class K0>
+static void HashInlineKeysSwitch(DataChunk &groups, hash_t *hashes) {
+	const auto keys0 = FlatVector::GetData<K0>(groups.data[0]);
+	if (groups.ColumnCount() == 1) {
+		TemplatedHashInlineKeys<K0>(keys0, hashes, groups.size());
+	} else if (GetInlineKeyWidth(groups.data[1].GetType()) == sizeof(uint32_t)) {
+		TemplatedHashInlineKeys<K0, uint32_t>(keys0, FlatVector::GetData<uint32_t>(groups.data[1]), hashes,
+		                                      groups.size());
+	} else {
+		TemplatedHashInlineKeys<K0, uint64_t>(keys0, FlatVector::GetData<uint64_t>(groups.data[1]), hashes,
+		                                      groups.size());
+	}
+}
+
+void GroupedAggregateHashTable::HashGroups(DataChunk &groups, Vector &hashes) {
+	bool dense = inline_keys;
+	for (idx_t col_idx = 0; dense && col_idx < groups.ColumnCount(); col_idx++) {
+		auto &group = groups.data[col_idx];
+		dense = group.GetVectorType() == VectorType::FLAT_VECTOR && FlatVector::Validity(group).AllValid();
+	}
+	if (!dense) {
+		// NULLs, constants, dictionaries, or other types: fall back to the generic hash
+		groups.Hash(hashes);
+		return;
+	}
+
+	hashes.SetVectorType(VectorType::FLAT_VECTOR);
+	const auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	if (GetInlineKeyWidth(groups.data[0].GetType()) == sizeof(uint32_t)) {
+		HashInlineKeysSwitch<uint32_t>(groups, hash_data);
+	} else {
+		HashInlineKeysSwitch<uint64_t>(groups, hash_data);
+	}
+
+#ifdef DEBUG
+	// The hashes are stored with the groups and used for partitioning, they must be the same as the generic hash
+	Vector verify_hashes(LogicalType::HASH);
+	groups.Hash(verify_hashes);
+	verify_hashes.Flatten(groups.size());
+	const auto verify_data = FlatVector::GetData<hash_t>(verify_hashes);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		D_ASSERT(hash_data[i] == verify_data[i]);
+	}
+#endif
+}
+
+template <class K>
+static inline bool InlineKeyMatches(const UnifiedVectorFormat &format, const idx_t idx, const data_ptr_t row_location,
+                                    const idx_t offset_in_row, const idx_t col_idx) {
+	// The validity of the first (at most 8) columns is always stored in the first byte of the row
+	const auto row_valid = ValidityBytes::RowIsValid(ValidityBytes(row_location).GetValidityEntryUnsafe(0), col_idx);
+	const auto key_idx = format.sel->get_index(idx);
+	if (!format.validity.RowIsValid(key_idx)) {
+		// NULL groups are matched with NOT DISTINCT FROM semantics
+		return !row_valid;
+	}
+	return row_valid && UnifiedVectorFormat::GetData<K>(format)[key_idx] == Load<K>(row_location + offset_in_row);
+}
+
+template <class K0, class K1, bool TWO_KEYS>
+static idx_t TemplatedMatchInlineKeys(const UnifiedVectorFormat *group_data, SelectionVector &sel, const idx_t count,
+                                      const TupleDataLayout &layout, Vector &addresses, SelectionVector &no_match_sel,
+                                      idx_t &no_match_count) {
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(addresses);
+	const auto offset0 = layout.GetOffsets()[0];
+	const auto offset1 = TWO_KEYS ? layout.GetOffsets()[1] : 0;
+
+	idx_t match_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto &row_location = row_locations[idx];
+		if (InlineKeyMatches<K0>(group_data[0], idx, row_location, offset0, 0) &&
+		    (!TWO_KEYS || InlineKeyMatches<K1>(group_data[1], idx, row_location, offset1, 1))) {
+			sel.set_index(match_count++, idx);
+		} else {
+			no_match_sel.set_index(no_match_count++, idx);
+		}
+	}
+	return match_count;
+}
+
+template <class K0>
+static idx_t MatchInlineKeysSwitch(const UnifiedVectorFormat *group_data, SelectionVector &sel, const idx_t count,
+                                   const TupleDataLayout &layout, Vector &addresses, SelectionVector &no_match_sel,
+                                   idx_t &no_match_count) {
+	if (layout.ColumnCount() == 2) {
+		return TemplatedMatchInlineKeys<K0, K0, false>(group_data, sel, count, layout, addresses, no_match_sel,
+		                                               no_match_count);
+	} else if (GetInlineKeyWidth(layout.GetTypes()[1]) == sizeof(uint32_t)) {
+		return TemplatedMatchInlineKeys<K0, uint32_t, true>(group_data, sel, count, layout, addresses, no_match_sel,
+		                                                    no_match_count);
+	} else {
+		return TemplatedMatchInlineKeys<K0, uint64_t, true>(group_data, sel, count, layout, addresses, no_match_sel,
+		                                                    no_match_count);
+	}
+}
+
+idx_t GroupedAggregateHashTable::MatchInlineKeys(SelectionVector &sel, const idx_t count, Vector &addresses,
+                                                 SelectionVector &no_match_sel, idx_t &no_match_count) {
+	D_ASSERT(inline_keys);
+	if (GetInlineKeyWidth(layout.GetTypes()[0]) == sizeof(uint32_t)) {
+		return MatchInlineKeysSwitch<uint32_t>(state.group_data.get(), sel, count, layout, addresses, no_match_sel,
+		                                       no_match_count);
+	} else {
+		return MatchInlineKeysSwitch<uint64_t>(state.group_data.get(), sel, count, layout, addresses, no_match_sel,
+		                                       no_match_count);
+	}
+}
+
 idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes_v,
                                                             Vector &addresses_v, SelectionVector &new_groups_out) {
 	D_ASSERT(groups.ColumnCount() + 1 == layout.ColumnCount());
@@ -340,23 +536,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
 
 	// Make a chunk that references the groups and the hashes and convert to unified format
-	if (state.group_chunk.ColumnCount() == 0) {
-		state.group_chunk.InitializeEmpty(layout.GetTypes());
-	}
-	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
-	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
-		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
-	}
-	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
-	state.group_chunk.SetCardinality(groups);
-
-	// convert all vectors to unified format
+	InitializeGroupChunk(groups, group_hashes_v);
 	auto &chunk_state = state.append_state.chunk_state;
-	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
-	if (!state.group_data) {
-		state.group_data = make_unsafe_uniq_array<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
-	}
-	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
@@ -431,8 +612,13 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 			}
 
 			// Perform group comparisons
-			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
-			                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			if (inline_keys) {
+				MatchInlineKeys(state.group_compare_vector, need_compare_count, addresses_v, state.no_match_vector,
+				                no_match_count);
+			} else {
+				row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
+				                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			}
 		}
 
 		// Linear probing: each of the entries that do not match move to the next entry in the HT
@@ -469,7 +655,7 @@ void GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &ad
 idx_t GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &addresses_out,
                                                     SelectionVector &new_groups_out) {
 	Vector hashes(LogicalType::HASH);
-	groups.Hash(hashes);
+	HashGroups(groups, hashes);
 	return FindOrCreateGroups(groups, hashes, addresses_out, new_groups_out);
 }
 
@@ -1,5 +1,6 @@
 #include "duckdb/execution/index/art/art.hpp"
 
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -21,7 +22,9 @@ namespace duckdb {
 
 struct ARTIndexScanState : public IndexScanState {
 
-	//! Scan predicates (single predicate scan or range scan)
+	//! Equality predicates on a prefix of the key columns
+	vector<Value> prefix_values;
+	//! Scan predicates on the key column following the prefix (single predicate scan or range scan)
 	Value values[2];
 	//! Expressions of the scan predicates
 	ExpressionType expressions[2];
@@ -98,37 +101,19 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Predicate Scans
 //===--------------------------------------------------------------------===//
 
-//! Initialize a single predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Transaction &transaction, const Value &value,
-                                                                const ExpressionType expression_type) {
-	// initialize point lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
-}
-
-//! Initialize a two predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Transaction &transaction, const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	// initialize range lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
-}
-
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-                                                  const Expression &filter_expr) {
-
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-	// try to find a matching index for any of the filter expressions
+//! The predicates on a single key column
+struct ARTKeyPredicates {
+	Value equal_value;
+	Value low_value;
+	Value high_value;
+	ExpressionType low_comparison_type = ExpressionType::INVALID;
+	ExpressionType high_comparison_type = ExpressionType::INVALID;
+};
 
+//! Adds the predicate of the filter to the predicates of the key column, if the filter is a comparison of the indexed
+//! expression with a constant
+static void MatchKeyPredicate(const Expression &index_expr, const Expression &filter_expr,
+                              ARTKeyPredicates &predicates) {
 	// create a matcher for a comparison with a constant
 	ComparisonExpressionMatcher matcher;
 	// match on a comparison type
@@ -155,58 +140,81 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction
 		}
 		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
 			// equality value
-			// equality overrides any other bounds so we just break here
-			equal_value = constant_value;
+			predicates.equal_value = constant_value;
 		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
 		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
 			// greater than means this is a lower bound
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
+			if (predicates.low_value.IsNull()) {
+				predicates.low_value = constant_value;
+				predicates.low_comparison_type = comparison_type;
+			}
+		} else if (comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO ||
+		           comparison_type == ExpressionType::COMPARE_LESSTHAN) {
 			// smaller than means this is an upper bound
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
+			if (predicates.high_value.IsNull()) {
+				predicates.high_value = constant_value;
+				predicates.high_comparison_type = comparison_type;
+			}
 		}
 	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
 		// BETWEEN expression
 		auto &between = filter_expr.Cast<BoundBetweenExpression>();
 		if (!between.input->Equals(index_expr)) {
 			// expression doesn't match the index expression
-			return nullptr;
+			return;
 		}
 		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
 		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
 			// not a constant comparison
-			return nullptr;
+			return;
 		}
-		low_value = (between.lower->Cast<BoundConstantExpression>()).value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
+		predicates.low_value = (between.lower->Cast<BoundConstantExpression>()).value;
+		predicates.low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                                         : ExpressionType::COMPARE_GREATERTHAN;
+		predicates.high_value = (between.upper->Cast<BoundConstantExpression>()).value;
+		predicates.high_comparison_type =
 		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
 	}
+}
 
-	if (!equal_value.IsNull() || !low_value.IsNull() || !high_value.IsNull()) {
-		// we can scan this index using this predicate: try a scan
-		unique_ptr<IndexScanState> index_state;
-		if (!equal_value.IsNull()) {
-			// equality predicate
-			index_state = InitializeScanSinglePredicate(transaction, equal_value, ExpressionType::COMPARE_EQUAL);
-		} else if (!low_value.IsNull() && !high_value.IsNull()) {
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction,
+                                                  const vector<unique_ptr<Expression>> &index_exprs,
+                                                  const vector<unique_ptr<Expression>> &filter_exprs) {
+	D_ASSERT(index_exprs.size() <= types.size());
+	auto result = make_uniq<ARTIndexScanState>();
+	for (idx_t key_idx = 0; key_idx < index_exprs.size(); key_idx++) {
+		ARTKeyPredicates predicates;
+		for (auto &filter_expr : filter_exprs) {
+			MatchKeyPredicate(*index_exprs[key_idx], *filter_expr, predicates);
+		}
+		if (!predicates.equal_value.IsNull()) {
+			// equality overrides any other bounds: the key column extends the prefix of the scan
+			result->prefix_values.push_back(predicates.equal_value);
+			continue;
+		}
+		if (!predicates.low_value.IsNull() && !predicates.high_value.IsNull()) {
 			// two-sided predicate
-			index_state = InitializeScanTwoPredicates(transaction, low_value, low_comparison_type, high_value,
-			                                          high_comparison_type);
-		} else if (!low_value.IsNull()) {
+			result->values[0] = predicates.low_value;
+			result->expressions[0] = predicates.low_comparison_type;
+			result->values[1] = predicates.high_value;
+			result->expressions[1] = predicates.high_comparison_type;
+		} else if (!predicates.low_value.IsNull()) {
+			// greater than predicate
+			result->values[0] = predicates.low_value;
+			result->expressions[0] = predicates.low_comparison_type;
+		} else if (!predicates.high_value.IsNull()) {
 			// less than predicate
-			index_state = InitializeScanSinglePredicate(transaction, low_value, low_comparison_type);
-		} else {
-			D_ASSERT(!high_value.IsNull());
-			index_state = InitializeScanSinglePredicate(transaction, high_value, high_comparison_type);
+			result->values[0] = predicates.high_value;
+			result->expressions[0] = predicates.high_comparison_type;
 		}
-		return index_state;
+		// the key columns following a range predicate cannot be used
+		break;
 	}
-	return nullptr;
+	if (result->prefix_values.empty() && result->values[0].IsNull()) {
+		// the filters do not restrict the first key column
+		return nullptr;
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -452,6 +460,10 @@ bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_ide
 	// prepare the row_identifiers
 	row_identifiers.Flatten(count);
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	return ConstructFromSorted(count, keys, row_ids);
+}
+
+bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, row_t *row_ids) {
 
 	auto key_section = KeySection(0, count - 1, 0, 0);
 	auto has_constraint = IsUnique();
@@ -840,6 +852,63 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 	return nullptr;
 }
 
+void ART::Lookup(const vector<ARTKey> &keys, const idx_t count, vector<Node> &leaves) {
+
+	leaves.assign(count, Node());
+	if (!tree.HasMetadata()) {
+		return;
+	}
+
+	// the current node and depth of each key that is still being traversed
+	vector<Node> nodes(count);
+	vector<idx_t> depths(count, 0);
+	vector<idx_t> active;
+	for (idx_t i = 0; i < count; i++) {
+		if (!keys[i].Empty()) {
+			nodes[i] = tree;
+			active.push_back(i);
+		}
+	}
+
+	while (!active.empty()) {
+		idx_t remaining = 0;
+		for (auto &key_idx : active) {
+			auto &key = keys[key_idx];
+			auto &depth = depths[key_idx];
+
+			// traverse prefix, if exists
+			reference<const Node> next_node(nodes[key_idx]);
+			if (next_node.get().GetType() == NType::PREFIX) {
+				Prefix::Traverse(*this, next_node, key, depth);
+				if (next_node.get().GetType() == NType::PREFIX) {
+					continue;
+				}
+			}
+
+			if (next_node.get().GetType() == NType::LEAF || next_node.get().GetType() == NType::LEAF_INLINED) {
+				leaves[key_idx] = next_node.get();
+				continue;
+			}
+
+			D_ASSERT(depth < key.len);
+			auto child = next_node.get().GetChild(*this, key[depth]);
+			if (!child) {
+				continue;
+			}
+			nodes[key_idx] = *child;
+			depth++;
+
+			// the child is visited after the nodes of all other keys, by which time it is in the cache
+			if (nodes[key_idx].GetType() != NType::LEAF_INLINED) {
+				auto &allocator = Node::GetAllocator(*this, nodes[key_idx].GetType());
+				DUCKDB_PREFETCH(allocator.Get<const data_t>(nodes[key_idx], false));
+			}
+			active[remaining++] = key_idx;
+		}
+		active.resize(remaining);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Greater Than and Less Than
 //===--------------------------------------------------------------------===//
@@ -918,29 +987,65 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	bool success;
 
 	// FIXME: the key directly owning the data for a single key might be more efficient
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
 	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
+	const auto prefix_count = scan_state.prefix_values.size();
+	ARTKey prefix;
+	for (idx_t key_idx = 0; key_idx < prefix_count; key_idx++) {
+		D_ASSERT(scan_state.prefix_values[key_idx].type().InternalType() == types[key_idx]);
+		auto key = CreateKey(arena_allocator, types[key_idx], scan_state.prefix_values[key_idx]);
+		if (key_idx == 0) {
+			prefix = key;
+		} else {
+			prefix.ConcatenateARTKey(arena_allocator, key);
+		}
+	}
+	// creates the key of a predicate value on the key column following the prefix
+	auto create_bound = [&](Value &value) {
+		D_ASSERT(value.type().InternalType() == types[prefix_count]);
+		auto key = CreateKey(arena_allocator, types[prefix_count], value);
+		if (prefix_count == 0) {
+			return key;
+		}
+		auto bound = prefix;
+		bound.ConcatenateARTKey(arena_allocator, key);
+		return bound;
+	};
+
+	if (scan_state.values[0].IsNull()) {
 
-	if (scan_state.values[1].IsNull()) {
+		// equality predicates only
+		lock_guard<mutex> l(lock);
+		if (prefix_count == types.size()) {
+			success = SearchEqual(prefix, max_count, row_ids);
+		} else {
+			// all keys that start with the prefix: bytes beyond the length of a bound are not compared
+			success = SearchCloseRange(scan_state, prefix, prefix, true, true, max_count, row_ids);
+		}
+
+	} else if (scan_state.values[1].IsNull()) {
 
 		// single predicate
 		lock_guard<mutex> l(lock);
-		switch (scan_state.expressions[0]) {
-		case ExpressionType::COMPARE_EQUAL:
-			success = SearchEqual(key, max_count, row_ids);
-			break;
+		auto key = create_bound(scan_state.values[0]);
+		const auto comparison = scan_state.expressions[0];
+		const auto equal = comparison == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+		                   comparison == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+		switch (comparison) {
 		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			success = SearchGreater(scan_state, key, true, max_count, row_ids);
-			break;
 		case ExpressionType::COMPARE_GREATERTHAN:
-			success = SearchGreater(scan_state, key, false, max_count, row_ids);
+			if (prefix_count == 0) {
+				success = SearchGreater(scan_state, key, equal, max_count, row_ids);
+			} else {
+				success = SearchCloseRange(scan_state, key, prefix, equal, true, max_count, row_ids);
+			}
 			break;
 		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			success = SearchLess(scan_state, key, true, max_count, row_ids);
-			break;
 		case ExpressionType::COMPARE_LESSTHAN:
-			success = SearchLess(scan_state, key, false, max_count, row_ids);
+			if (prefix_count == 0) {
+				success = SearchLess(scan_state, key, equal, max_count, row_ids);
+			} else {
+				success = SearchCloseRange(scan_state, prefix, key, true, equal, max_count, row_ids);
+			}
 			break;
 		default:
 			throw InternalException("Index scan type not implemented");
@@ -950,13 +1055,12 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 
 		// two predicates
 		lock_guard<mutex> l(lock);
-
-		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
-		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
+		auto lower_bound = create_bound(scan_state.values[0]);
+		auto upper_bound = create_bound(scan_state.values[1]);
 
 		bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
 		bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
-		success = SearchCloseRange(scan_state, key, upper_bound, left_equal, right_equal, max_count, row_ids);
+		success = SearchCloseRange(scan_state, lower_bound, upper_bound, left_equal, right_equal, max_count, row_ids);
 	}
 
 	if (!success) {
@@ -1045,6 +1149,10 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	vector<ARTKey> keys(expression_chunk.size());
 	GenerateKeys(arena_allocator, expression_chunk, keys);
 
+	// look up all keys at once
+	vector<Node> leaves;
+	Lookup(keys, input.size(), leaves);
+
 	idx_t found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 
@@ -1055,7 +1163,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 			continue;
 		}
 
-		auto leaf = Lookup(tree, keys[i], 0);
+		auto leaf = leaves[i].HasMetadata() ? &leaves[i] : nullptr;
 		if (!leaf) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
@@ -1258,6 +1366,50 @@ bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 	return true;
 }
 
+vector<ARTFlags> ART::InitializeMerges(const vector<reference<ART>> &others) {
+
+	D_ASSERT(owns_data);
+
+	// each allocator merge appends the buffers of the other allocator after the current upper bound buffer ID
+	ARTFlags flags;
+	InitializeMerge(flags);
+
+	vector<ARTFlags> result;
+	for (auto &other_ref : others) {
+		auto &other = other_ref.get();
+		D_ASSERT(other.owns_data);
+		result.push_back(flags);
+		for (idx_t i = 0; i < allocators->size(); i++) {
+			flags.merge_buffer_counts[i] += (*other.allocators)[i]->GetUpperBoundBufferId();
+		}
+	}
+	return result;
+}
+
+void ART::PrepareMerge(const ARTFlags &flags) {
+	if (tree.HasMetadata()) {
+		tree.InitializeMerge(*this, flags);
+	}
+}
+
+bool ART::MergePrepared(const vector<reference<ART>> &others) {
+
+	// first, merge all node storage, so that the buffer IDs match the offsets of InitializeMerges
+	for (auto &other : others) {
+		for (idx_t i = 0; i < allocators->size(); i++) {
+			(*allocators)[i]->Merge(*(*other.get().allocators)[i]);
+		}
+	}
+
+	// then, merge the trees, which allocates new nodes in the merged node storage
+	for (auto &other : others) {
+		if (!tree.Merge(*this, other.get().tree)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Utility
 //===--------------------------------------------------------------------===//
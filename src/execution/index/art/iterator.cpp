@@ -15,7 +15,9 @@ bool IteratorKey::operator>(const ARTKey &key) const {
 			return false;
 		}
 	}
-	return key_bytes.size() > key.len;
+	// keys that start with the other key are not greater, so that it can bound a scan on a prefix of a compound key
+	// (this does not change the order of full keys, as no full key is a prefix of another one)
+	return false;
 }
 
 bool IteratorKey::operator>=(const ARTKey &key) const {
@@ -115,6 +117,15 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return true;
 	}
 
+	if (depth >= key.len) {
+		// all keys in this subtree have the (compound key prefix) key as their prefix
+		if (equal) {
+			FindMinimum(node);
+			return true;
+		}
+		return Next();
+	}
+
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
 		auto child = node.GetNextChild(*art, next_byte);
@@ -145,6 +156,14 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	nodes.emplace(node, 0);
 
 	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		if (depth + i >= key.len) {
+			// the key is a prefix of all keys in this subtree
+			if (equal) {
+				FindMinimum(prefix.ptr);
+				return true;
+			}
+			return Next();
+		}
 		// the key down to this node is less than the lower bound, the next key will be
 		// greater than the lower bound
 		if (prefix.data[i] < key[depth + i]) {
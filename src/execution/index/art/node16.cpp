@@ -1,7 +1,9 @@
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 
 namespace duckdb {
 
@@ -12,6 +14,8 @@ Node16 &Node16::New(ART &art, Node &node) {
 	auto &n16 = Node::RefMutable<Node16>(art, node, NType::NODE_16);
 
 	n16.count = 0;
+	// the key search reads all key bytes, so we initialize the unused ones
+	memset(n16.key, 0, sizeof(n16.key));
 	return n16;
 }
 
@@ -144,46 +148,58 @@ void Node16::ReplaceChild(const uint8_t byte, const Node child) {
 	}
 }
 
+//! Returns the position of the first key that satisfies OP, or NODE_16_CAPACITY, if there is none. The comparison loop
+//! has a fixed trip count over all key bytes, which compilers turn into a single SIMD comparison and a move mask
+template <class OP>
+static inline idx_t FindKey(const uint8_t *key, const uint8_t count, const uint8_t byte) {
+	uint32_t mask = 0;
+	for (idx_t i = 0; i < Node::NODE_16_CAPACITY; i++) {
+		mask |= static_cast<uint32_t>(OP::Operation(key[i], byte)) << i;
+	}
+	mask &= (uint32_t(1) << count) - 1;
+	if (!mask) {
+		return Node::NODE_16_CAPACITY;
+	}
+	return CountZeros<uint32_t>::Trailing(mask);
+}
+
 optional_ptr<const Node> Node16::GetChild(const uint8_t byte) const {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] == byte) {
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	auto pos = FindKey<Equals>(key, count, byte);
+	if (pos == Node::NODE_16_CAPACITY) {
+		return nullptr;
 	}
-	return nullptr;
+	D_ASSERT(children[pos].HasMetadata());
+	return &children[pos];
 }
 
 optional_ptr<Node> Node16::GetChildMutable(const uint8_t byte) {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] == byte) {
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	auto pos = FindKey<Equals>(key, count, byte);
+	if (pos == Node::NODE_16_CAPACITY) {
+		return nullptr;
 	}
-	return nullptr;
+	D_ASSERT(children[pos].HasMetadata());
+	return &children[pos];
 }
 
 optional_ptr<const Node> Node16::GetNextChild(uint8_t &byte) const {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] >= byte) {
-			byte = key[i];
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	// the keys are sorted, so the first greater or equal key is the next child
+	auto pos = FindKey<GreaterThanEquals>(key, count, byte);
+	if (pos == Node::NODE_16_CAPACITY) {
+		return nullptr;
 	}
-	return nullptr;
+	byte = key[pos];
+	D_ASSERT(children[pos].HasMetadata());
+	return &children[pos];
 }
 
 optional_ptr<Node> Node16::GetNextChildMutable(uint8_t &byte) {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] >= byte) {
-			byte = key[i];
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	auto pos = FindKey<GreaterThanEquals>(key, count, byte);
+	if (pos == Node::NODE_16_CAPACITY) {
+		return nullptr;
 	}
-	return nullptr;
+	byte = key[pos];
+	D_ASSERT(children[pos].HasMetadata());
+	return &children[pos];
 }
 
 void Node16::Vacuum(ART &art, const ARTFlags &flags) {
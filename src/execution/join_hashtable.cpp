@@ -1,6 +1,7 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -18,7 +19,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), prefetch(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0),
+      partition_end(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -113,6 +115,12 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx
 		auto hash = hash_data[hindex];
 		result_data[rindex] = main_ht + (hash & bitmask);
 	}
+	if (prefetch) {
+		// the buckets are only read after all of them have been computed, so we can overlap the cache misses
+		for (idx_t i = 0; i < count; i++) {
+			DUCKDB_PREFETCH(result_data[sel.get_index(i)]);
+		}
+	}
 }
 
 void JoinHashTable::Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes) {
@@ -304,6 +312,13 @@ void JoinHashTable::InitializePointerTable() {
 	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
 
 	bitmask = capacity - 1;
+
+	// if the HT does not fit in the CPU caches, (almost) every bucket lookup and chain traversal is a cache miss
+	prefetch = hash_map.GetSize() + data_collection->SizeInBytes() > PREFETCH_THRESHOLD;
+}
+
+void JoinHashTable::InitializeBloomFilter() {
+	bloom_filter = make_uniq<BloomFilter>(Count());
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -321,6 +336,9 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			bloom_filter->Insert(hash_data, count, parallel);
+		}
 		InsertHashes(hashes, count, row_locations, parallel);
 	} while (iterator.Next());
 }
@@ -460,6 +478,21 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		}
 	}
 	this->count = new_count;
+	PrefetchRows();
+}
+
+void ScanStructure::PrefetchRows() {
+	if (!ht.prefetch) {
+		return;
+	}
+	// the rows are compared with the keys (and followed to the next entry in the chain) only after all pointers of
+	// this vector have been loaded, so we can overlap the cache misses
+	auto ptrs = FlatVector::GetData<data_ptr_t>(this->pointers);
+	for (idx_t i = 0; i < this->count; i++) {
+		auto row = ptrs[this->sel_vector.get_index(i)];
+		DUCKDB_PREFETCH(row);
+		DUCKDB_PREFETCH(row + ht.pointer_offset);
+	}
 }
 
 void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_sel) {
@@ -474,6 +507,7 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 		}
 	}
 	count = non_empty_count;
+	PrefetchRows();
 }
 
 void ScanStructure::AdvancePointers() {
@@ -0,0 +1,504 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(ClientContext &context, vector<LogicalType> types_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t clustered_group_idx_p, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)), clustered_group_idx(clustered_group_idx_p) {
+	D_ASSERT(clustered_group_idx < groups.size());
+	for (auto &expr : groups) {
+		group_types.push_back(expr->return_type);
+	}
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.IsDistinct());
+		D_ASSERT(!aggr.filter);
+		D_ASSERT(aggr.function.combine);
+		bindings.push_back(&aggr);
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+		}
+	}
+	auto layout_types = group_types;
+	layout_types.push_back(LogicalType::HASH);
+	layout.Initialize(std::move(layout_types), AggregateObject::CreateAggregateObjects(bindings));
+}
+
+//===--------------------------------------------------------------------===//
+// Clustered Group Range
+//===--------------------------------------------------------------------===//
+template <class T>
+static void TemplatedUpdateRange(Vector &input, const SelectionVector &sel, idx_t count, Vector &range,
+                                 bool &has_range) {
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	auto data = UnifiedVectorFormat::GetData<T>(input_data);
+	auto range_data = FlatVector::GetData<T>(range);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(sel.get_index(i));
+		if (!input_data.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto &value = data[idx];
+		if (!has_range) {
+			range_data[0] = value;
+			range_data[1] = value;
+			has_range = true;
+		} else if (LessThan::Operation(value, range_data[0])) {
+			range_data[0] = value;
+		} else if (GreaterThan::Operation(value, range_data[1])) {
+			range_data[1] = value;
+		}
+	}
+}
+
+//! Extends the [min, max] range of the clustered group with the (non-NULL) values of the selected rows
+static void UpdateRange(Vector &input, const SelectionVector &sel, idx_t count, Vector &range, bool &has_range) {
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return TemplatedUpdateRange<int8_t>(input, sel, count, range, has_range);
+	case PhysicalType::INT16:
+		return TemplatedUpdateRange<int16_t>(input, sel, count, range, has_range);
+	case PhysicalType::INT32:
+		return TemplatedUpdateRange<int32_t>(input, sel, count, range, has_range);
+	case PhysicalType::INT64:
+		return TemplatedUpdateRange<int64_t>(input, sel, count, range, has_range);
+	case PhysicalType::INT128:
+		return TemplatedUpdateRange<hugeint_t>(input, sel, count, range, has_range);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateRange<uint8_t>(input, sel, count, range, has_range);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateRange<uint16_t>(input, sel, count, range, has_range);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateRange<uint32_t>(input, sel, count, range, has_range);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateRange<uint64_t>(input, sel, count, range, has_range);
+	case PhysicalType::UINT128:
+		return TemplatedUpdateRange<uhugeint_t>(input, sel, count, range, has_range);
+	case PhysicalType::FLOAT:
+		return TemplatedUpdateRange<float>(input, sel, count, range, has_range);
+	case PhysicalType::DOUBLE:
+		return TemplatedUpdateRange<double>(input, sel, count, range, has_range);
+	default:
+		throw InternalException("Unsupported type for the clustered group of a streaming aggregate");
+	}
+}
+
+template <class T>
+static idx_t TemplatedSelectInterior(Vector &input, idx_t count, Vector &range, SelectionVector &interior_sel,
+                                     SelectionVector &boundary_sel) {
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	auto data = UnifiedVectorFormat::GetData<T>(input_data);
+	auto range_data = FlatVector::GetData<T>(range);
+	idx_t interior_count = 0;
+	idx_t boundary_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (input_data.validity.RowIsValid(idx) && GreaterThan::Operation(data[idx], range_data[0]) &&
+		    LessThan::Operation(data[idx], range_data[1])) {
+			interior_sel.set_index(interior_count++, i);
+		} else {
+			boundary_sel.set_index(boundary_count++, i);
+		}
+	}
+	return interior_count;
+}
+
+//! Splits the groups into the groups that lie strictly within the range of the clustered group, and the others
+static idx_t SelectInterior(Vector &input, idx_t count, Vector &range, SelectionVector &interior_sel,
+                            SelectionVector &boundary_sel) {
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return TemplatedSelectInterior<int8_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::INT16:
+		return TemplatedSelectInterior<int16_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::INT32:
+		return TemplatedSelectInterior<int32_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::INT64:
+		return TemplatedSelectInterior<int64_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::INT128:
+		return TemplatedSelectInterior<hugeint_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::UINT8:
+		return TemplatedSelectInterior<uint8_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::UINT16:
+		return TemplatedSelectInterior<uint16_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::UINT32:
+		return TemplatedSelectInterior<uint32_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::UINT64:
+		return TemplatedSelectInterior<uint64_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::UINT128:
+		return TemplatedSelectInterior<uhugeint_t>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::FLOAT:
+		return TemplatedSelectInterior<float>(input, count, range, interior_sel, boundary_sel);
+	case PhysicalType::DOUBLE:
+		return TemplatedSelectInterior<double>(input, count, range, interior_sel, boundary_sel);
+	default:
+		throw InternalException("Unsupported type for the clustered group of a streaming aggregate");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+static unique_ptr<GroupedAggregateHashTable> CreateHT(const PhysicalStreamingAggregate &op, ClientContext &context) {
+	return make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), op.group_types,
+	                                            op.payload_types, op.bindings);
+}
+
+class StreamingAggregateGlobalState : public GlobalSinkState {
+public:
+	StreamingAggregateGlobalState(const PhysicalStreamingAggregate &op, ClientContext &context)
+	    : results(BufferManager::GetBufferManager(context), op.types), boundary_ht(CreateHT(op, context)) {
+	}
+
+	mutex lock;
+	//! The finalized groups
+	ColumnDataCollection results;
+	//! The aggregate allocators of the batches that were combined into the boundary groups
+	vector<shared_ptr<ArenaAllocator>> stored_allocators;
+	//! The groups that occur at the boundaries of batches, these are combined across batches
+	unique_ptr<GroupedAggregateHashTable> boundary_ht;
+};
+
+class StreamingAggregateLocalState : public LocalSinkState {
+public:
+	StreamingAggregateLocalState(const PhysicalStreamingAggregate &op, ExecutionContext &context)
+	    : layout(op.layout.Copy()), batch_range(op.group_types[op.clustered_group_idx], 2),
+	      run_sel(STANDARD_VECTOR_SIZE), run_addresses(LogicalType::POINTER), group_addresses(LogicalType::POINTER),
+	      interior_sel(STANDARD_VECTOR_SIZE), boundary_sel(STANDARD_VECTOR_SIZE),
+	      source_addresses(LogicalType::POINTER), target_addresses(LogicalType::POINTER) {
+		group_chunk.InitializeEmpty(op.group_types);
+		run_chunk.InitializeEmpty(op.group_types);
+		if (!op.payload_types.empty()) {
+			aggregate_input_chunk.InitializeEmpty(op.payload_types);
+		}
+		boundary_chunk.InitializeEmpty(op.group_types);
+		result_chunk.Initialize(Allocator::Get(context.client), op.types);
+		results = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context.client), op.types);
+	}
+
+	TupleDataLayout layout;
+	DataChunk group_chunk;
+	DataChunk aggregate_input_chunk;
+	DataChunk result_chunk;
+
+	//! The batch that is currently being aggregated (if the source supports batch indexes)
+	optional_idx current_batch;
+	//! The groups of the current batch
+	unique_ptr<GroupedAggregateHashTable> batch_ht;
+	//! The minimum and maximum value of the clustered group in the current batch
+	Vector batch_range;
+	bool has_batch_range = false;
+	//! The finalized groups of this thread
+	unique_ptr<ColumnDataCollection> results;
+
+	//! Whether or not a row starts a new run of identical groups
+	bool run_start[STANDARD_VECTOR_SIZE];
+	//! The first row of every run, and the aggregate states of the runs
+	SelectionVector run_sel;
+	DataChunk run_chunk;
+	Vector run_addresses;
+	//! The aggregate state of every row of the input chunk
+	Vector group_addresses;
+
+	//! Splits the groups of a finished batch into interior and boundary groups
+	SelectionVector interior_sel;
+	SelectionVector boundary_sel;
+	DataChunk boundary_chunk;
+	Vector source_addresses;
+	Vector target_addresses;
+};
+
+unique_ptr<GlobalSinkState> PhysicalStreamingAggregate::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<StreamingAggregateGlobalState>(*this, context);
+}
+
+unique_ptr<LocalSinkState> PhysicalStreamingAggregate::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateLocalState>(*this, context);
+}
+
+//! Finishes the current batch: the groups that lie strictly within the range of the clustered group of the batch
+//! cannot occur in any other batch and are finalized, the other groups are combined into the boundary groups
+static void FlushBatch(const PhysicalStreamingAggregate &op, StreamingAggregateGlobalState &gstate,
+                       StreamingAggregateLocalState &lstate) {
+	if (!lstate.batch_ht) {
+		return;
+	}
+	auto &batch_ht = *lstate.batch_ht;
+	auto &layout = lstate.layout;
+	batch_ht.UnpinData();
+	auto &data = *batch_ht.GetPartitionedData()->GetPartitions()[0];
+
+	vector<column_t> column_ids;
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		column_ids.push_back(group_idx);
+	}
+	TupleDataScanState scan_state;
+	data.InitializeScan(scan_state, std::move(column_ids), TupleDataPinProperties::UNPIN_AFTER_DONE);
+	DataChunk scan_chunk;
+	data.InitializeScanChunk(scan_state, scan_chunk);
+
+	// without a batch index we know nothing about the groups of the other threads
+	bool has_interior = lstate.current_batch.IsValid() && lstate.has_batch_range;
+	bool has_boundary = false;
+	RowOperationsState row_state(*batch_ht.GetAggregateAllocator());
+	while (data.Scan(scan_state, scan_chunk)) {
+		auto count = scan_chunk.size();
+		auto &row_locations = scan_state.chunk_state.row_locations;
+		idx_t interior_count = 0;
+		auto boundary_sel = FlatVector::IncrementalSelectionVector();
+		if (has_interior) {
+			interior_count = SelectInterior(scan_chunk.data[op.clustered_group_idx], count, lstate.batch_range,
+			                                lstate.interior_sel, lstate.boundary_sel);
+			boundary_sel = &lstate.boundary_sel;
+		}
+		auto boundary_count = count - interior_count;
+
+		// the interior groups are complete: finalize them
+		if (interior_count > 0) {
+			auto &result = lstate.result_chunk;
+			result.Reset();
+			for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+				result.data[group_idx].Slice(scan_chunk.data[group_idx], lstate.interior_sel, interior_count);
+			}
+			result.SetCardinality(interior_count);
+			Vector interior_addresses(row_locations, lstate.interior_sel, interior_count);
+			RowOperations::FinalizeStates(row_state, layout, interior_addresses, result, op.groups.size());
+			lstate.results->Append(result);
+		}
+
+		// the boundary groups are combined with the boundary groups of the other batches
+		if (boundary_count > 0) {
+			auto &boundary_chunk = lstate.boundary_chunk;
+			boundary_chunk.Slice(scan_chunk, *boundary_sel, boundary_count);
+			lstate.source_addresses.Slice(row_locations, *boundary_sel, boundary_count);
+			lstate.source_addresses.Flatten(boundary_count);
+
+			lock_guard<mutex> guard(gstate.lock);
+			auto &boundary_ht = *gstate.boundary_ht;
+			boundary_ht.FindOrCreateGroups(boundary_chunk, lstate.target_addresses);
+			RowOperationsState combine_state(*boundary_ht.GetAggregateAllocator());
+			RowOperations::CombineStates(combine_state, layout, lstate.source_addresses, lstate.target_addresses,
+			                             boundary_count);
+			has_boundary = true;
+		}
+	}
+
+	if (has_boundary) {
+		// the combined states can still reference data in the aggregate allocator of the batch (e.g., LIST segments)
+		lock_guard<mutex> guard(gstate.lock);
+		gstate.stored_allocators.push_back(batch_ht.GetAggregateAllocator());
+	}
+	// destroying the hash table destroys the aggregate states of the batch
+	lstate.batch_ht.reset();
+	lstate.has_batch_range = false;
+}
+
+SinkResultType PhysicalStreamingAggregate::Sink(ExecutionContext &context, DataChunk &chunk,
+                                                OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<StreamingAggregateGlobalState>();
+	auto &lstate = input.local_state.Cast<StreamingAggregateLocalState>();
+
+	auto &batch_index = lstate.partition_info.batch_index;
+	if (batch_index.IsValid() && lstate.current_batch.IsValid() &&
+	    batch_index.GetIndex() != lstate.current_batch.GetIndex()) {
+		// we moved on to the next batch: the groups of the previous batch no longer change
+		FlushBatch(*this, gstate, lstate);
+	}
+	lstate.current_batch = batch_index;
+
+	auto &group_chunk = lstate.group_chunk;
+	auto &aggregate_input_chunk = lstate.aggregate_input_chunk;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &bound_ref_expr = groups[group_idx]->Cast<BoundReferenceExpression>();
+		group_chunk.data[group_idx].Reference(chunk.data[bound_ref_expr.index]);
+	}
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		for (auto &child_expr : aggr.children) {
+			auto &bound_ref_expr = child_expr->Cast<BoundReferenceExpression>();
+			aggregate_input_chunk.data[aggregate_input_idx++].Reference(chunk.data[bound_ref_expr.index]);
+		}
+	}
+	auto count = chunk.size();
+	group_chunk.SetCardinality(count);
+	aggregate_input_chunk.SetCardinality(count);
+	if (count == 0) {
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	if (!lstate.batch_ht) {
+		lstate.batch_ht = CreateHT(*this, context.client);
+	}
+	auto &batch_ht = *lstate.batch_ht;
+
+	// the input is clustered: find the runs of identical groups, so we only have to look up every run once
+	auto run_start = lstate.run_start;
+	run_start[0] = true;
+	memset(run_start + 1, 0, (count - 1) * sizeof(bool));
+	if (count > 1) {
+		SelectionVector current_sel(count - 1);
+		SelectionVector previous_sel(count - 1);
+		for (idx_t i = 0; i + 1 < count; i++) {
+			current_sel.set_index(i, i + 1);
+			previous_sel.set_index(i, i);
+		}
+		SelectionVector distinct_sel(count - 1);
+		for (auto &group_vector : group_chunk.data) {
+			Vector current(group_vector, current_sel, count - 1);
+			Vector previous(group_vector, previous_sel, count - 1);
+			auto distinct_count =
+			    VectorOperations::DistinctFrom(current, previous, nullptr, count - 1, &distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				run_start[distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+	}
+	idx_t run_count = 0;
+	for (idx_t row = 0; row < count; row++) {
+		if (run_start[row]) {
+			lstate.run_sel.set_index(run_count++, row);
+		}
+	}
+
+	// keep track of the range of the clustered group in this batch: every value starts a run
+	UpdateRange(group_chunk.data[clustered_group_idx], lstate.run_sel, run_count, lstate.batch_range,
+	            lstate.has_batch_range);
+
+	// look up the groups of the runs, and assign the state of its run to every row
+	auto &group_addresses = lstate.group_addresses;
+	if (run_count == count) {
+		batch_ht.FindOrCreateGroups(group_chunk, group_addresses);
+	} else {
+		lstate.run_chunk.Slice(group_chunk, lstate.run_sel, run_count);
+		batch_ht.FindOrCreateGroups(lstate.run_chunk, lstate.run_addresses);
+		auto run_address_data = FlatVector::GetData<data_ptr_t>(lstate.run_addresses);
+		group_addresses.SetVectorType(VectorType::FLAT_VECTOR);
+		auto address_data = FlatVector::GetData<data_ptr_t>(group_addresses);
+		idx_t run_idx = 0;
+		for (idx_t row = 0; row < count; row++) {
+			run_idx += run_start[row];
+			address_data[row] = run_address_data[run_idx - 1];
+		}
+	}
+
+	// update the aggregate states of the groups
+	auto &layout = lstate.layout;
+	VectorOperations::AddInPlace(group_addresses, UnsafeNumericCast<int64_t>(layout.GetAggrOffset()), count);
+	idx_t payload_idx = 0;
+	RowOperationsState row_state(*batch_ht.GetAggregateAllocator());
+	for (auto &aggregate : layout.GetAggregates()) {
+		RowOperations::UpdateStates(row_state, aggregate, group_addresses, aggregate_input_chunk, payload_idx, count);
+		payload_idx += aggregate.child_count;
+		VectorOperations::AddInPlace(group_addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Combine
+//===--------------------------------------------------------------------===//
+SinkCombineResultType PhysicalStreamingAggregate::Combine(ExecutionContext &context,
+                                                          OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<StreamingAggregateGlobalState>();
+	auto &lstate = input.local_state.Cast<StreamingAggregateLocalState>();
+
+	FlushBatch(*this, gstate, lstate);
+
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.results.Combine(*lstate.results);
+	return SinkCombineResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+SinkFinalizeType PhysicalStreamingAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                      OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<StreamingAggregateGlobalState>();
+	gstate.boundary_ht->UnpinData();
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class StreamingAggregateSourceState : public GlobalSourceState {
+public:
+	StreamingAggregateSourceState(const PhysicalStreamingAggregate &op, StreamingAggregateGlobalState &gstate)
+	    : layout(op.layout.Copy()), boundary_data(*gstate.boundary_ht->GetPartitionedData()->GetPartitions()[0]) {
+		gstate.results.InitializeScan(scan_state);
+		vector<column_t> column_ids;
+		for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+			column_ids.push_back(group_idx);
+		}
+		boundary_data.InitializeScan(boundary_scan_state, std::move(column_ids));
+		boundary_data.InitializeScanChunk(boundary_scan_state, boundary_chunk);
+	}
+
+	TupleDataLayout layout;
+	ColumnDataScanState scan_state;
+	//! The boundary groups are finalized after the finalized groups have been scanned
+	TupleDataCollection &boundary_data;
+	TupleDataScanState boundary_scan_state;
+	DataChunk boundary_chunk;
+};
+
+unique_ptr<GlobalSourceState> PhysicalStreamingAggregate::GetGlobalSourceState(ClientContext &context) const {
+	auto &gstate = sink_state->Cast<StreamingAggregateGlobalState>();
+	return make_uniq<StreamingAggregateSourceState>(*this, gstate);
+}
+
+SourceResultType PhysicalStreamingAggregate::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                     OperatorSourceInput &input) const {
+	auto &gstate = sink_state->Cast<StreamingAggregateGlobalState>();
+	auto &state = input.global_state.Cast<StreamingAggregateSourceState>();
+
+	if (gstate.results.Scan(state.scan_state, chunk)) {
+		return SourceResultType::HAVE_MORE_OUTPUT;
+	}
+	auto &boundary_chunk = state.boundary_chunk;
+	if (!state.boundary_data.Scan(state.boundary_scan_state, boundary_chunk)) {
+		return SourceResultType::FINISHED;
+	}
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		chunk.data[group_idx].Reference(boundary_chunk.data[group_idx]);
+	}
+	chunk.SetCardinality(boundary_chunk);
+	RowOperationsState row_state(*gstate.boundary_ht->GetAggregateAllocator());
+	RowOperations::FinalizeStates(row_state, state.layout, state.boundary_scan_state.chunk_state.row_locations, chunk,
+	                              groups.size());
+	return SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -207,12 +207,17 @@ public:
 	atomic<idx_t> tasks_remaining;
 	//! The number of rows returned
 	atomic<idx_t> returned;
+	//! The groups that are being finalised (protected by built_lock)
+	vector<WindowPartitionSourceState *> finalizing;
 
 public:
 	idx_t MaxThreads() override {
 		return tasks_remaining;
 	}
 
+	//! Help finalising a group that is being built, returns false if there is nothing to do
+	bool HelpFinalize();
+
 private:
 	Task CreateTask(idx_t hash_bin);
 	Task StealWork();
@@ -261,13 +266,16 @@ public:
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
 
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), helpers(0), read_block_idx(0), unscanned(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
 	unique_ptr<RowDataCollectionScanner> GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	//! Finalise the executors, which other threads can help with
+	void FinalizeExecutors();
+	bool HelpFinalize();
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -289,6 +297,8 @@ public:
 
 	//! The bin number
 	idx_t hash_bin;
+	//! The number of threads helping to finalise the executors (protected by the built_lock)
+	idx_t helpers;
 
 	//! The next block to read.
 	mutable atomic<idx_t> read_block_idx;
@@ -437,10 +447,7 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
-	for (auto &wexec : executors) {
-		wexec->Finalize();
-	}
+	FinalizeExecutors();
 
 	// External scanning assumes all blocks are swizzled.
 	scanner->ReSwizzle();
@@ -449,6 +456,58 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 	unscanned = rows->blocks.size();
 }
 
+void WindowPartitionSourceState::FinalizeExecutors() {
+	//	Idle threads can help with building the executors (e.g., constructing segment trees),
+	//	so a single huge partition (e.g., OVER (ORDER BY ...)) is not built by a single thread
+	{
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		gsource.finalizing.emplace_back(this);
+	}
+
+	for (auto &wexec : executors) {
+		wexec->Finalize();
+	}
+
+	//	Wait for the helpers to leave before anyone can destroy the executors
+	while (true) {
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		auto &finalizing = gsource.finalizing;
+		auto entry = std::find(finalizing.begin(), finalizing.end(), this);
+		if (entry != finalizing.end()) {
+			finalizing.erase(entry);
+		}
+		if (!helpers) {
+			break;
+		}
+		TaskScheduler::YieldThread();
+	}
+}
+
+bool WindowPartitionSourceState::HelpFinalize() {
+	for (auto &wexec : executors) {
+		if (wexec->HelpFinalize()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool WindowGlobalSourceState::HelpFinalize() {
+	unique_lock<mutex> built_guard(built_lock);
+	for (idx_t i = 0; i < finalizing.size(); ++i) {
+		auto partition_source = finalizing[i];
+		++partition_source->helpers;
+		built_guard.unlock();
+		const auto helped = partition_source->HelpFinalize();
+		built_guard.lock();
+		--partition_source->helpers;
+		if (helped) {
+			return true;
+		}
+	}
+	return false;
+}
+
 // Per-thread scan state
 class WindowLocalSourceState : public LocalSourceState {
 public:
@@ -580,7 +639,10 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 		}
 
 		//	If there is nothing to steal but there are unfinished partitions,
-		//	yield until any pending builds are done.
+		//	help with the pending builds or yield until they are done.
+		if (HelpFinalize()) {
+			continue;
+		}
 		TaskScheduler::YieldThread();
 	}
 
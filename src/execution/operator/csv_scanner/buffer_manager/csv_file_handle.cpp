@@ -72,6 +72,10 @@ idx_t CSVFileHandle::Read(void *buffer, idx_t nr_bytes) {
 	if (!finished) {
 		finished = bytes_read == 0;
 	}
+	if (!on_disk_file && uncompressed && can_seek && UnsafeNumericCast<idx_t>(bytes_read) == nr_bytes) {
+		// remote files can already start fetching the next buffer while this one is being parsed
+		file_handle->ReadAhead(file_handle->SeekPosition(), nr_bytes);
+	}
 	return UnsafeNumericCast<idx_t>(bytes_read);
 }
 
@@ -138,6 +138,74 @@ bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source,
 	return true;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filter
+//===--------------------------------------------------------------------===//
+unique_ptr<BloomFilter> PerfectHashJoinExecutor::CreateBloomFilter(const LogicalType &key_type) {
+	if (perfect_join_statistics.is_build_dense || unique_keys == 0) {
+		// the min/max filters that are pushed into the probe side are exact already
+		return nullptr;
+	}
+	auto bloom_filter = make_uniq<BloomFilter>(unique_keys);
+	switch (key_type.InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedFillBloomFilter<int8_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::INT16:
+		TemplatedFillBloomFilter<int16_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::INT32:
+		TemplatedFillBloomFilter<int32_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::INT64:
+		TemplatedFillBloomFilter<int64_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedFillBloomFilter<uint8_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedFillBloomFilter<uint16_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedFillBloomFilter<uint32_t>(key_type, *bloom_filter);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedFillBloomFilter<uint64_t>(key_type, *bloom_filter);
+		break;
+	default:
+		return nullptr;
+	}
+	return bloom_filter;
+}
+
+template <typename T>
+void PerfectHashJoinExecutor::TemplatedFillBloomFilter(const LogicalType &key_type, BloomFilter &bloom_filter) {
+	// reconstruct the build keys from the occupied slots of the build range, and insert their hashes
+	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
+	const auto build_size = perfect_join_statistics.build_range + 1;
+
+	Vector keys(key_type, STANDARD_VECTOR_SIZE);
+	Vector hashes(LogicalType::HASH, STANDARD_VECTOR_SIZE);
+	auto key_data = FlatVector::GetData<T>(keys);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	idx_t count = 0;
+	for (idx_t idx = 0; idx < build_size; idx++) {
+		if (!bitmap_build_idx[idx]) {
+			continue;
+		}
+		key_data[count++] = UnsafeNumericCast<T>(min_value + static_cast<T>(idx));
+		if (count == STANDARD_VECTOR_SIZE) {
+			VectorOperations::Hash(keys, hashes, count);
+			bloom_filter.Insert(hash_data, count, false);
+			count = 0;
+		}
+	}
+	if (count > 0) {
+		VectorOperations::Hash(keys, hashes, count);
+		bloom_filter.Insert(hash_data, count, false);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Probe
 //===--------------------------------------------------------------------===//
@@ -13,7 +13,9 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -87,8 +89,9 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 //===--------------------------------------------------------------------===//
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
-	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
-	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
+	    : op(op_p), context(context_p),
+	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_update_count(0),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      scanned_data(false) {
@@ -103,12 +106,17 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+		// Initialize the statistics of the join keys we push filters for
+		InitializeKeyStatistics(op, key_statistics);
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
 
+	static void InitializeKeyStatistics(const PhysicalHashJoin &op, vector<unique_ptr<BaseStatistics>> &statistics);
+
 public:
+	const PhysicalHashJoin &op;
 	ClientContext &context;
 
 	const idx_t num_threads;
@@ -136,6 +144,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! Min/max statistics of the join keys for join filter pushdown
+	vector<unique_ptr<BaseStatistics>> key_statistics;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +166,8 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		HashJoinGlobalSinkState::InitializeKeyStatistics(op, key_statistics);
 	}
 
 public:
@@ -171,8 +184,76 @@ public:
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
+
+	//! Thread-local min/max statistics of the join keys for join filter pushdown
+	vector<unique_ptr<BaseStatistics>> key_statistics;
 };
 
+void HashJoinGlobalSinkState::InitializeKeyStatistics(const PhysicalHashJoin &op,
+                                                      vector<unique_ptr<BaseStatistics>> &statistics) {
+	if (!op.filter_pushdown) {
+		return;
+	}
+	for (auto &column : op.filter_pushdown->columns) {
+		if (!column.push_min_max) {
+			statistics.push_back(nullptr);
+			continue;
+		}
+		auto &key_type = op.condition_types[column.join_condition];
+		statistics.push_back(NumericStats::CreateEmpty(key_type).ToUnique());
+	}
+}
+
+template <class T>
+static void TemplatedUpdateKeyStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			NumericStats::Update<T>(stats, data[idx]);
+		}
+	}
+}
+
+static void UpdateKeyStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateKeyStatistics<int8_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateKeyStatistics<int16_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateKeyStatistics<int32_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateKeyStatistics<int64_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateKeyStatistics<hugeint_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateKeyStatistics<uint8_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateKeyStatistics<uint16_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateKeyStatistics<uint32_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateKeyStatistics<uint64_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateKeyStatistics<uhugeint_t>(stats, keys, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
 	auto result = make_uniq<JoinHashTable>(BufferManager::GetBufferManager(context), conditions, payload_types,
 	                                       join_type, rhs_output_columns);
@@ -255,6 +336,16 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 		ht.Build(lstate.append_state, lstate.join_keys, lstate.payload_chunk);
 	}
 
+	if (filter_pushdown) {
+		for (idx_t i = 0; i < filter_pushdown->columns.size(); i++) {
+			auto &stats = lstate.key_statistics[i];
+			if (stats) {
+				auto &column = filter_pushdown->columns[i];
+				UpdateKeyStatistics(*stats, lstate.join_keys.data[column.join_condition], lstate.join_keys.size());
+			}
+		}
+	}
+
 	if (++lstate.chunk_count % HashJoinLocalSinkState::CHUNK_COUNT_UPDATE_INTERVAL == 0) {
 		auto &gstate = input.global_state.Cast<HashJoinGlobalSinkState>();
 		if (++gstate.temporary_memory_update_count % gstate.num_threads == 0) {
@@ -274,6 +365,11 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
+		for (idx_t i = 0; i < lstate.key_statistics.size(); i++) {
+			if (lstate.key_statistics[i]) {
+				gstate.key_statistics[i]->Merge(*lstate.key_statistics[i]);
+			}
+		}
 	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
@@ -348,6 +444,7 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		sink.op.PushBloomFilter(*sink.hash_table);
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -460,6 +557,8 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	PushJoinFilters(sink);
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
@@ -503,10 +602,23 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		D_ASSERT(ht.equality_types.size() == 1);
 		auto key_type = ht.equality_types[0];
 		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		if (use_perfect_hash && filter_pushdown && filter_pushdown->push_bloom_filter) {
+			// the perfect hash table knows which keys of the build range occur, push them into the probe side
+			auto bloom_filter = sink.perfect_join_executor->CreateBloomFilter(key_type);
+			if (bloom_filter) {
+				auto &column = filter_pushdown->columns[0];
+				filter_pushdown->dynamic_filters->PushFilter(*this, column.probe_column_index, std::move(bloom_filter));
+			}
+		}
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (filter_pushdown && filter_pushdown->push_bloom_filter &&
+		    ht.Count() <= JoinFilterPushdownInfo::BLOOM_FILTER_MAX_BUILD_SIZE) {
+			// build a Bloom filter while constructing the pointer table, it is pushed into the probe side after
+			ht.InitializeBloomFilter();
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -516,6 +628,52 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	return SinkFinalizeType::READY;
 }
 
+//===--------------------------------------------------------------------===//
+// Join Filter Pushdown
+//===--------------------------------------------------------------------===//
+void PhysicalHashJoin::PushJoinFilters(GlobalSinkState &sink_p) const {
+	if (!filter_pushdown) {
+		return;
+	}
+	auto &sink = sink_p.Cast<HashJoinGlobalSinkState>();
+	auto &dynamic_filters = *filter_pushdown->dynamic_filters;
+	// remove the filters of a previous execution of this join (if any)
+	dynamic_filters.ClearFilters(*this);
+	for (idx_t i = 0; i < filter_pushdown->columns.size(); i++) {
+		auto &stats = sink.key_statistics[i];
+		if (!stats || !NumericStats::HasMinMax(*stats)) {
+			continue;
+		}
+		auto min_value = NumericStats::Min(*stats);
+		auto max_value = NumericStats::Max(*stats);
+		if (min_value > max_value) {
+			// the build side is empty, or all of its keys are NULL
+			continue;
+		}
+		auto &column = filter_pushdown->columns[i];
+		if (min_value == max_value) {
+			dynamic_filters.PushFilter(*this, column.probe_column_index,
+			                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_value)));
+			continue;
+		}
+		dynamic_filters.PushFilter(
+		    *this, column.probe_column_index,
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_value)));
+		dynamic_filters.PushFilter(
+		    *this, column.probe_column_index,
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_value)));
+	}
+}
+
+void PhysicalHashJoin::PushBloomFilter(JoinHashTable &ht) const {
+	if (!filter_pushdown || !ht.bloom_filter) {
+		return;
+	}
+	D_ASSERT(filter_pushdown->push_bloom_filter);
+	auto &column = filter_pushdown->columns[0];
+	filter_pushdown->dynamic_filters->PushFilter(*this, column.probe_column_index, ht.bloom_filter->Copy());
+}
+
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
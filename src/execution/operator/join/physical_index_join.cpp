@@ -0,0 +1,214 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/index/art/leaf.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                                     unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond,
+                                     JoinType join_type, const vector<idx_t> &probe_projection_map_p,
+                                     vector<column_t> fetch_ids_p, vector<LogicalType> fetch_types_p,
+                                     bool fetched_columns_first, DuckTableEntry &table, ART &index,
+                                     idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::INDEX_JOIN, std::move(cond), join_type, estimated_cardinality),
+      probe_projection_map(probe_projection_map_p), fetch_ids(std::move(fetch_ids_p)),
+      fetch_types(std::move(fetch_types_p)), fetched_columns_first(fetched_columns_first), table(table),
+      index(index) {
+	D_ASSERT(join_type == JoinType::INNER);
+	D_ASSERT(conditions.size() == 1);
+	D_ASSERT(!fetch_ids.empty() && fetch_ids.back() == COLUMN_IDENTIFIER_ROW_ID);
+
+	children.push_back(std::move(left));
+	children.push_back(std::move(right));
+
+	if (probe_projection_map.empty()) {
+		for (idx_t col_idx = 0; col_idx < children[0]->types.size(); col_idx++) {
+			probe_projection_map.push_back(col_idx);
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : arena_allocator(BufferAllocator::Get(context)), probe_executor(context), keys(STANDARD_VECTOR_SIZE),
+	      row_ids(LogicalType::ROW_TYPE), probe_sel(STANDARD_VECTOR_SIZE), probed(false) {
+		auto &condition = op.conditions[0];
+		probe_executor.AddExpression(*condition.left);
+		join_keys.Initialize(Allocator::Get(context), {condition.left->return_type});
+		fetch_chunk.Initialize(Allocator::Get(context), op.fetch_types);
+
+		// rows that were appended by this transaction are not in the index of the table (yet), but in the index of
+		// the transaction-local storage, which maintains the same constraints
+		auto &transaction = DuckTransaction::Get(context, op.table.catalog);
+		auto &local_storage = LocalStorage::Get(transaction);
+		auto &storage = op.table.GetStorage();
+		if (local_storage.Find(storage)) {
+			local_storage.GetIndexes(storage).Scan([&](Index &index) {
+				if (index.IsBound() && index.GetIndexType() == ART::TYPE_NAME &&
+				    index.GetIndexName() == op.index.GetIndexName()) {
+					local_index = &index.Cast<ART>();
+					return true;
+				}
+				return false;
+			});
+		}
+	}
+
+	ArenaAllocator arena_allocator;
+	DataChunk join_keys;
+	ExpressionExecutor probe_executor;
+	vector<ARTKey> keys;
+	vector<Node> leaves;
+	//! The matches (probe row and row id in the table) of the current input, first for the table and then for the
+	//! transaction-local storage
+	vector<sel_t> match_rows;
+	vector<row_t> match_row_ids;
+	idx_t local_match_start;
+	//! The number of matches that have been emitted
+	idx_t match_offset;
+
+	optional_ptr<ART> local_index;
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	Vector row_ids;
+	SelectionVector probe_sel;
+	//! Whether or not the index has been probed with the current input
+	bool probed;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context.client, *this);
+}
+
+static void ProbeIndex(ART &index, IndexJoinOperatorState &state, idx_t count) {
+	IndexLock index_lock;
+	index.InitializeLock(index_lock);
+	// NULL keys never match
+	index.Lookup(state.keys, count, state.leaves);
+	vector<row_t> result_ids;
+	for (idx_t i = 0; i < count; i++) {
+		if (!state.leaves[i].HasMetadata()) {
+			continue;
+		}
+		result_ids.clear();
+		Leaf::GetRowIds(index, state.leaves[i], result_ids, NumericLimits<idx_t>::Maximum());
+		for (auto &row_id : result_ids) {
+			state.match_rows.push_back(UnsafeNumericCast<sel_t>(i));
+			state.match_row_ids.push_back(row_id);
+		}
+	}
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+
+	if (!state.probed) {
+		// look up all the keys of the input in the index (vector-at-a-time)
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		state.arena_allocator.Reset();
+		ART::GenerateKeys(state.arena_allocator, state.join_keys, state.keys);
+
+		state.match_rows.clear();
+		state.match_row_ids.clear();
+		ProbeIndex(index, state, input.size());
+		state.local_match_start = state.match_rows.size();
+		if (state.local_index) {
+			ProbeIndex(*state.local_index, state, input.size());
+		}
+		state.match_offset = 0;
+		state.probed = true;
+	}
+
+	// fetch the matching rows, one vector at a time, until there is output
+	idx_t result_count = 0;
+	while (result_count == 0 && state.match_offset < state.match_rows.size()) {
+		// a batch of rows is fetched either from the table or from the transaction-local storage
+		const auto is_local = state.match_offset >= state.local_match_start;
+		const auto batch_end = is_local ? state.match_rows.size() : state.local_match_start;
+		const auto fetch_count = MinValue<idx_t>(batch_end - state.match_offset, STANDARD_VECTOR_SIZE);
+
+		const auto row_id_data = FlatVector::GetData<row_t>(state.row_ids);
+		for (idx_t i = 0; i < fetch_count; i++) {
+			row_id_data[i] = state.match_row_ids[state.match_offset + i];
+		}
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			LocalStorage::Get(transaction)
+			    .FetchChunk(table.GetStorage(), state.row_ids, fetch_count, fetch_ids, state.fetch_chunk,
+			                state.fetch_state);
+		} else {
+			table.GetStorage().Fetch(transaction, state.fetch_chunk, fetch_ids, state.row_ids, fetch_count,
+			                         state.fetch_state);
+		}
+
+		// rows that are not visible to this transaction are skipped by the fetch, the fetched row ids tell us which
+		// probe rows the fetched rows belong to (the order of the row ids is preserved)
+		const auto fetched_row_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data.back());
+		for (idx_t i = 0; i < fetch_count && result_count < state.fetch_chunk.size(); i++) {
+			if (fetched_row_ids[result_count] == row_id_data[i]) {
+				state.probe_sel.set_index(result_count++, state.match_rows[state.match_offset + i]);
+			}
+		}
+		D_ASSERT(result_count == state.fetch_chunk.size());
+		state.match_offset += fetch_count;
+	}
+
+	// construct the result from the probe columns and the fetched columns (without the row id)
+	const auto fetched_count = state.fetch_chunk.ColumnCount() - 1;
+	const auto probe_offset = fetched_columns_first ? fetched_count : 0;
+	const auto fetched_offset = fetched_columns_first ? 0 : probe_projection_map.size();
+	for (idx_t i = 0; i < probe_projection_map.size(); i++) {
+		chunk.data[probe_offset + i].Slice(input.data[probe_projection_map[i]], state.probe_sel, result_count);
+	}
+	for (idx_t i = 0; i < fetched_count; i++) {
+		chunk.data[fetched_offset + i].Reference(state.fetch_chunk.data[i]);
+	}
+	D_ASSERT(probe_projection_map.size() + fetched_count == chunk.ColumnCount());
+	chunk.SetCardinality(result_count);
+
+	if (state.match_offset < state.match_rows.size()) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.probed = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalIndexJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	// the table is probed through the index: only the probe side is part of the pipeline, the scan is never executed
+	op_state.reset();
+	auto &state = meta_pipeline.GetState();
+	state.AddPipelineOperator(current, *this);
+	children[0]->BuildPipelines(current, meta_pipeline);
+}
+
+vector<const_reference<PhysicalOperator>> PhysicalIndexJoin::GetSources() const {
+	return children[0]->GetSources();
+}
+
+} // namespace duckdb
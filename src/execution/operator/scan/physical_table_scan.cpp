@@ -37,9 +37,31 @@ public:
 	idx_t max_threads = 0;
 	unique_ptr<GlobalTableFunctionState> global_state;
 
+	//! The table filters combined with the dynamic filters of the scan
+	mutex filter_lock;
+	bool initialized_filters = false;
+	unique_ptr<TableFilterSet> table_filters;
+
 	idx_t MaxThreads() override {
 		return max_threads;
 	}
+
+	//! Returns the table filters of the scan, including the dynamic filters that were pushed into it at runtime
+	optional_ptr<TableFilterSet> GetTableFilters(const PhysicalTableScan &op) {
+		if (!op.dynamic_filters) {
+			return op.table_filters.get();
+		}
+		// the global state is created before the operators pushing dynamic filters have finished
+		// the local states are only created once the pipeline of this scan starts executing, so we combine them here
+		lock_guard<mutex> guard(filter_lock);
+		if (!initialized_filters) {
+			if (op.dynamic_filters->HasFilters()) {
+				table_filters = op.dynamic_filters->GetFinalTableFilters(op.table_filters.get());
+			}
+			initialized_filters = true;
+		}
+		return table_filters ? table_filters.get() : op.table_filters.get();
+	}
 };
 
 class TableScanLocalSourceState : public LocalSourceState {
@@ -47,7 +69,8 @@ public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids,
+			                             gstate.GetTableFilters(op));
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
@@ -7,6 +7,8 @@
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
@@ -35,6 +37,10 @@ class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	//! Global index to be added to the table
 	unique_ptr<BoundIndex> global_index;
+
+	mutex lock;
+	//! The local indexes of all threads, which are merged into the global index in Finalize
+	vector<unique_ptr<BoundIndex>> local_indexes;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
@@ -46,6 +52,10 @@ public:
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! The keys and row IDs of the current sorted run (batch), their key data lives in the arena allocator
+	vector<ARTKey> run_keys;
+	vector<row_t> run_row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -100,23 +110,45 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, Ope
 SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
 
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto count = l_state.key_chunk.size();
+
+	// the chunks of a batch arrive in order, so we collect the keys of the whole run and build its ART at once
+	row_identifiers.Flatten(count);
+	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	for (idx_t i = 0; i < count; i++) {
+		l_state.run_keys.push_back(l_state.keys[i]);
+		l_state.run_row_ids.push_back(row_ids[i]);
+	}
+
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalCreateARTIndex::BuildSortedRun(LocalSinkState &local_state) const {
+
+	auto &l_state = local_state.Cast<CreateARTIndexLocalSinkState>();
+	if (l_state.run_keys.empty()) {
+		return;
+	}
 	auto &storage = table.GetStorage();
 	auto &l_index = l_state.local_index;
 
-	// create an ART from the chunk
+	// create an ART from the sorted run, its nodes are allocated in the storage of the local ART
 	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
 	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
 	                          l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
+	if (!art->ConstructFromSorted(l_state.run_keys.size(), l_state.run_keys, l_state.run_row_ids.data())) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
-	// merge into the local ART
+	// merge into the local ART: the runs cover disjoint key ranges, so this only touches the nodes on the path to
+	// the boundary keys, and the node storage is shared
 	if (!l_index->MergeIndexes(*art)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
-	return SinkResultType::NEED_MORE_INPUT;
+	l_state.run_keys.clear();
+	l_state.run_row_ids.clear();
+	l_state.arena_allocator.Reset();
 }
 
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
@@ -127,7 +159,9 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 	// generate the keys for the given input
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	l_state.arena_allocator.Reset();
+	if (!sorted) {
+		l_state.arena_allocator.Reset();
+	}
 	ART::GenerateKeys(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
 
 	// insert the keys and their corresponding row IDs
@@ -138,29 +172,117 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 	return SinkUnsorted(row_identifiers, input);
 }
 
+SinkNextBatchType PhysicalCreateARTIndex::NextBatch(ExecutionContext &context,
+                                                   OperatorSinkNextBatchInput &input) const {
+	// the previous batch is complete
+	BuildSortedRun(input.local_state);
+	return SinkNextBatchType::READY;
+}
+
 SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
                                                       OperatorSinkCombineInput &input) const {
 
 	auto &gstate = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	if (sorted) {
+		BuildSortedRun(lstate);
+	}
 
-	// merge the local index into the global index
-	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	// the local indexes are merged in Finalize, where the expensive part of the merge runs in parallel
+	if (lstate.local_index->Cast<ART>().tree.HasMetadata()) {
+		lock_guard<mutex> guard(gstate.lock);
+		gstate.local_indexes.push_back(std::move(lstate.local_index));
 	}
 
 	return SinkCombineResultType::FINISHED;
 }
 
+class CreateARTIndexMergeTask : public ExecutorTask {
+public:
+	CreateARTIndexMergeTask(shared_ptr<Event> event_p, ClientContext &context, ART &art, const ARTFlags &flags)
+	    : ExecutorTask(context, std::move(event_p)), art(art), flags(flags) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		art.PrepareMerge(flags);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	ART &art;
+	const ARTFlags &flags;
+};
+
+//! Merges the local indexes into the global index. Traversing the local indexes to shift their buffer IDs is the
+//! expensive part of a merge, which is done in parallel. Then, all node storage is moved to the global index, and the
+//! trees are merged serially
+class CreateARTIndexMergeEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexMergeEvent(Pipeline &pipeline_p, const PhysicalCreateARTIndex &op_p,
+	                         CreateARTIndexGlobalSinkState &gstate_p, ClientContext &context_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p), context(context_p) {
+	}
+
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+	ClientContext &context;
+
+	vector<reference<ART>> others;
+	vector<ARTFlags> merge_flags;
+
+public:
+	void Schedule() override {
+		auto &global_art = gstate.global_index->Cast<ART>();
+		for (auto &local_index : gstate.local_indexes) {
+			others.push_back(local_index->Cast<ART>());
+		}
+		merge_flags = global_art.InitializeMerges(others);
+
+		vector<shared_ptr<Task>> merge_tasks;
+		for (idx_t i = 0; i < others.size(); i++) {
+			merge_tasks.push_back(
+			    make_uniq<CreateARTIndexMergeTask>(shared_from_this(), context, others[i], merge_flags[i]));
+		}
+		SetTasks(std::move(merge_tasks));
+	}
+
+	void FinishEvent() override {
+		if (!gstate.global_index->Cast<ART>().MergePrepared(others)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+		gstate.local_indexes.clear();
+		op.AddIndexToStorage(context, std::move(gstate.global_index));
+	}
+};
+
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
 
-	// here, we set the resulting global index as the newly created index of the table
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	if (state.local_indexes.empty()) {
+		AddIndexToStorage(context, std::move(state.global_index));
+		return SinkFinalizeType::READY;
+	}
+
+	// the first local index becomes the global index
+	state.global_index = std::move(state.local_indexes[0]);
+	state.local_indexes.erase(state.local_indexes.begin());
+	if (state.local_indexes.empty()) {
+		AddIndexToStorage(context, std::move(state.global_index));
+		return SinkFinalizeType::READY;
+	}
+
+	auto new_event = make_shared_ptr<CreateARTIndexMergeEvent>(pipeline, *this, state, context);
+	event.InsertEvent(std::move(new_event));
+	return SinkFinalizeType::READY;
+}
+
+void PhysicalCreateARTIndex::AddIndexToStorage(ClientContext &context, unique_ptr<BoundIndex> global_index) const {
 
 	// vacuum excess memory and verify
-	state.global_index->Vacuum();
-	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
+	global_index->Vacuum();
+	D_ASSERT(!global_index->VerifyAndToString(true).empty());
 
 	auto &storage = table.GetStorage();
 	if (!storage.IsRoot()) {
@@ -173,10 +295,10 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 	if (!index_entry) {
 		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
 		// index already exists, but error ignored because of IF NOT EXISTS
-		return SinkFinalizeType::READY;
+		return;
 	}
 	auto &index = index_entry->Cast<DuckIndexEntry>();
-	index.initial_index_size = state.global_index->GetInMemorySize();
+	index.initial_index_size = global_index->GetInMemorySize();
 
 	index.info = make_shared_ptr<IndexDataTableInfo>(storage.GetDataTableInfo(), index.name);
 	for (auto &parsed_expr : info->parsed_expressions) {
@@ -184,8 +306,7 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 	}
 
 	// add index to storage
-	storage.AddIndex(std::move(state.global_index));
-	return SinkFinalizeType::READY;
+	storage.AddIndex(std::move(global_index));
 }
 
 //===--------------------------------------------------------------------===//
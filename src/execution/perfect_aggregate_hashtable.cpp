@@ -50,9 +50,11 @@ PerfectAggregateHashTable::~PerfectAggregateHashTable() {
 	Destroy();
 }
 
-template <class T>
-static void ComputeGroupLocationTemplated(UnifiedVectorFormat &group_data, Value &min, uintptr_t *address_data,
-                                          idx_t current_shift, idx_t count) {
+//! Adds the (one-indexed) offset of the group value from the minimum, shifted into position, to the group index.
+//! The first group column assigns the index instead, so the addresses do not have to be zero-initialized
+template <class T, bool FIRST>
+static void ComputeGroupLocationTemplated(UnifiedVectorFormat &group_data, Value &min,
+                                          uintptr_t *__restrict address_data, idx_t current_shift, idx_t count) {
 	auto data = UnifiedVectorFormat::GetData<T>(group_data);
 	auto min_val = min.GetValueUnsafe<T>();
 	if (!group_data.validity.AllValid()) {
@@ -61,51 +63,58 @@ static void ComputeGroupLocationTemplated(UnifiedVectorFormat &group_data, Value
 			// check if the value is NULL
 			// NULL groups are considered as "0" in the hash table
 			// that is to say, they have no effect on the position of the element (because 0 << shift is 0)
-			// we only need to handle non-null values here
+			uintptr_t adjusted_value = 0;
 			if (group_data.validity.RowIsValid(index)) {
 				D_ASSERT(data[index] >= min_val);
-				auto adjusted_value = UnsafeNumericCast<uintptr_t>((data[index] - min_val) + 1);
-				address_data[i] += adjusted_value << current_shift;
+				adjusted_value = UnsafeNumericCast<uintptr_t>((data[index] - min_val) + 1);
 			}
+			address_data[i] = (FIRST ? 0 : address_data[i]) + (adjusted_value << current_shift);
+		}
+	} else if (!group_data.sel->data()) {
+		// flat and no null values: a tight loop the compiler can vectorize
+		for (idx_t i = 0; i < count; i++) {
+			auto adjusted_value = UnsafeNumericCast<uintptr_t>((data[i] - min_val) + 1);
+			address_data[i] = (FIRST ? 0 : address_data[i]) + (adjusted_value << current_shift);
 		}
 	} else {
 		// no null values: we can directly compute the addresses
 		for (idx_t i = 0; i < count; i++) {
 			auto index = group_data.sel->get_index(i);
 			auto adjusted_value = UnsafeNumericCast<uintptr_t>((data[index] - min_val) + 1);
-			address_data[i] += adjusted_value << current_shift;
+			address_data[i] = (FIRST ? 0 : address_data[i]) + (adjusted_value << current_shift);
 		}
 	}
 }
 
+template <bool FIRST>
 static void ComputeGroupLocation(Vector &group, Value &min, uintptr_t *address_data, idx_t current_shift, idx_t count) {
 	UnifiedVectorFormat vdata;
 	group.ToUnifiedFormat(count, vdata);
 
 	switch (group.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		ComputeGroupLocationTemplated<int8_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<int8_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::INT16:
-		ComputeGroupLocationTemplated<int16_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<int16_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::INT32:
-		ComputeGroupLocationTemplated<int32_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<int32_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::INT64:
-		ComputeGroupLocationTemplated<int64_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<int64_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT8:
-		ComputeGroupLocationTemplated<uint8_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<uint8_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT16:
-		ComputeGroupLocationTemplated<uint16_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<uint16_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT32:
-		ComputeGroupLocationTemplated<uint32_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<uint32_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT64:
-		ComputeGroupLocationTemplated<uint64_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationTemplated<uint64_t, FIRST>(vdata, min, address_data, current_shift, count);
 		break;
 	default:
 		throw InternalException("Unsupported group type for perfect aggregate hash table");
@@ -115,15 +124,18 @@ static void ComputeGroupLocation(Vector &group, Value &min, uintptr_t *address_d
 void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload) {
 	// first we need to find the location in the HT of each of the groups
 	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
-	// zero-initialize the address data
-	memset(address_data, 0, groups.size() * sizeof(uintptr_t));
 	D_ASSERT(groups.ColumnCount() == group_minima.size());
+	D_ASSERT(groups.ColumnCount() > 0);
 
 	// then compute the actual group location by iterating over each of the groups
 	idx_t current_shift = total_required_bits;
 	for (idx_t i = 0; i < groups.ColumnCount(); i++) {
 		current_shift -= required_bits[i];
-		ComputeGroupLocation(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
+		if (i == 0) {
+			ComputeGroupLocation<true>(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
+		} else {
+			ComputeGroupLocation<false>(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
+		}
 	}
 	// now we have the HT entry number for every tuple
 	// compute the actual pointer to the data by adding it to the base HT pointer and multiplying by the tuple size
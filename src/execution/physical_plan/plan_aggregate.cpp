@@ -1,16 +1,28 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
@@ -28,10 +40,51 @@ hugeint_t GetRangeHugeint(const BaseStatistics &nstats) {
 	return Hugeint::Convert(NumericStats::GetMax<T>(nstats)) - Hugeint::Convert(NumericStats::GetMin<T>(nstats));
 }
 
-static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &bits_per_group) {
+//! The perfect hash threshold can grow up to this many bits when the input is large enough
+static constexpr idx_t MAXIMUM_ADAPTIVE_PERFECT_HT_BITS = 20;
+//! The minimum number of input rows (per thread) per entry of a perfect hash table that is larger than the threshold
+static constexpr idx_t ADAPTIVE_PERFECT_HT_ROWS_PER_ENTRY = 16;
+
+static idx_t GetPerfectHashThreshold(ClientContext &context, LogicalAggregate &op, idx_t input_cardinality) {
+	const auto threshold = ClientConfig::GetConfig(context).perfect_ht_threshold;
+	if (threshold == 0) {
+		// perfect hashing is disabled
+		return threshold;
+	}
+	// every thread initializes (and combines) a table of 2^bits entries, which pays off if the input is large enough
+	// to fill the tables of all threads, even if they are larger than the configured threshold
+	const auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	const auto entries_per_thread = input_cardinality / thread_count / ADAPTIVE_PERFECT_HT_ROWS_PER_ENTRY;
+	if (entries_per_thread == 0) {
+		return threshold;
+	}
+	// the tables are not managed by the buffer manager, so all of them together have to fit in the memory limit
+	// every entry holds the aggregate states and an "occupied" flag
+	vector<BoundAggregateExpression *> bindings;
+	for (auto &expression : op.expressions) {
+		bindings.push_back(&expression->Cast<BoundAggregateExpression>());
+	}
+	TupleDataLayout layout;
+	layout.Initialize(AggregateObject::CreateAggregateObjects(bindings));
+	const auto entry_size = layout.GetRowWidth() + sizeof(bool);
+	const auto max_memory = BufferManager::GetBufferManager(context).GetMaxMemory();
+	const auto memory_entries = max_memory / (thread_count * entry_size);
+
+	auto limited_entries = MinValue<idx_t>(entries_per_thread, idx_t(1) << MAXIMUM_ADAPTIVE_PERFECT_HT_BITS);
+	limited_entries = MinValue<idx_t>(limited_entries, memory_entries);
+	if (limited_entries == 0) {
+		return threshold;
+	}
+	const auto adaptive_bits = RequiredBitsForValue(UnsafeNumericCast<uint32_t>(limited_entries)) - 1;
+	return MaxValue<idx_t>(threshold, adaptive_bits);
+}
+
+static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, idx_t input_cardinality,
+                                       vector<idx_t> &bits_per_group) {
 	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
 		return false;
 	}
+	const auto perfect_ht_threshold = GetPerfectHashThreshold(context, op, input_cardinality);
 	idx_t perfect_hash_bits = 0;
 	if (op.group_stats.empty()) {
 		op.group_stats.resize(op.groups.size());
@@ -56,6 +109,13 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		}
 		// check if the group has stats available
 		auto &group_type = group->return_type;
+		if (group_type.id() == LogicalTypeId::ENUM && (!stats || !NumericStats::HasMinMax(*stats))) {
+			// the codes of an enum are dense and its domain is known, regardless of the width of the codes
+			auto enum_stats = NumericStats::CreateUnknown(group_type);
+			NumericStats::SetMin(enum_stats, Value::MinimumValue(group_type));
+			NumericStats::SetMax(enum_stats, Value::MaximumValue(group_type));
+			stats = enum_stats.ToUnique();
+		}
 		if (!stats) {
 			// no stats, but we might still be able to use perfect hashing if the type is small enough
 			// for small types we can just set the stats to [type_min, type_max]
@@ -134,7 +194,7 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		bits_per_group.push_back(required_bits);
 		perfect_hash_bits += required_bits;
 		// check if we have exceeded the bits for the hash
-		if (perfect_hash_bits > ClientConfig::GetConfig(context).perfect_ht_threshold) {
+		if (perfect_hash_bits > perfect_ht_threshold) {
 			// too many bits for perfect hash
 			return false;
 		}
@@ -149,10 +209,138 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Gets the column binding in the output of the child of an operator that a column expression of the operator refers
+//! to, the expressions have already been resolved to references into the child chunk when the plan is created
+static bool GetChildBinding(LogicalOperator &child, Expression &expr, ColumnBinding &binding) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+		return true;
+	}
+	if (expr.type != ExpressionType::BOUND_REF) {
+		return false;
+	}
+	auto index = expr.Cast<BoundReferenceExpression>().index;
+	auto bindings = child.GetColumnBindings();
+	if (index >= bindings.size()) {
+		return false;
+	}
+	binding = bindings[index];
+	return true;
+}
+
+//! Follows a column binding through projections and filters down to a base table scan
+static optional_ptr<LogicalGet> TraceTableColumn(LogicalOperator &op, ColumnBinding binding, column_t &column_id) {
+	reference<LogicalOperator> current(op);
+	while (true) {
+		switch (current.get().type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = current.get().Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return nullptr;
+			}
+			reference<Expression> expr(*proj.expressions[binding.column_index]);
+			if (expr.get().type == ExpressionType::BOUND_FUNCTION) {
+				// compressing an integral column subtracts its minimum: this preserves the order of the values
+				auto &func = expr.get().Cast<BoundFunctionExpression>();
+				if (!StringUtil::StartsWith(func.function.name, "__internal_compress_integral")) {
+					return nullptr;
+				}
+				expr = *func.children[0];
+			}
+			if (!GetChildBinding(*proj.children[0], expr, binding)) {
+				return nullptr;
+			}
+			current = *proj.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+			current = *current.get().children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_GET: {
+			auto &get = current.get().Cast<LogicalGet>();
+			if (binding.table_index != get.table_index || binding.column_index >= get.column_ids.size()) {
+				return nullptr;
+			}
+			column_id = get.column_ids[binding.column_index];
+			return &get;
+		}
+		default:
+			return nullptr;
+		}
+	}
+}
+
+//! Checks if the row groups of the table cover disjoint, ascending ranges of a column
+static bool IsClusteredOn(ClientContext &context, LogicalOperator &child, Expression &group) {
+	ColumnBinding binding;
+	if (!GetChildBinding(child, group, binding)) {
+		return false;
+	}
+	column_t column_id;
+	auto get = TraceTableColumn(child, binding, column_id);
+	if (!get || IsRowIdColumnId(column_id) || !get->function.get_batch_index) {
+		return false;
+	}
+	auto table = get->GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return false;
+	}
+	auto &storage = table->Cast<DuckTableEntry>().GetStorage();
+	if (LocalStorage::Get(context, table->catalog).Find(storage)) {
+		// transaction-local data is scanned after the row groups and is not covered by their statistics
+		return false;
+	}
+	// the row groups store the physical columns only, i.e. without the generated columns
+	auto storage_id = table->GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index;
+	auto row_group_stats = storage.GetRowGroupStatistics(storage_id);
+	if (row_group_stats.size() < 2) {
+		return false;
+	}
+	Value previous_max;
+	for (auto &stats : row_group_stats) {
+		if (!stats || stats->GetStatsType() != StatisticsType::NUMERIC_STATS || !NumericStats::HasMinMax(*stats)) {
+			return false;
+		}
+		auto min = NumericStats::Min(*stats);
+		if (!previous_max.IsNull() && min < previous_max) {
+			return false;
+		}
+		previous_max = NumericStats::Max(*stats);
+	}
+	return true;
+}
+
+static bool CanUseStreamingAggregate(ClientContext &context, LogicalAggregate &op, idx_t &clustered_group_idx) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (ClientConfig::GetConfig(context).verify_parallelism) {
+		// the batches are smaller than row groups: their ranges are not covered by the row group statistics
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys || !aggregate.function.combine) {
+			return false;
+		}
+	}
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		if (IsClusteredOn(context, *op.children[0], *op.groups[group_idx])) {
+			clustered_group_idx = group_idx;
+			return true;
+		}
+	}
+	return false;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// the child plan has to be inspected before it is converted into a physical plan
+	idx_t clustered_group_idx = 0;
+	bool use_streaming_aggregate = CanUseStreamingAggregate(context, op, clustered_group_idx);
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -180,10 +368,18 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (CanUsePerfectHashAggregate(context, op, plan->estimated_cardinality, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
+		} else if (use_streaming_aggregate) {
+			// the input is clustered on one of the groups: only the groups of the current row group are kept
+			// the clustering is derived from the current row group statistics: re-plan prepared statements, as the
+			// table might have been modified in the meantime
+			require_rebind = true;
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    context, op.types, std::move(op.expressions), std::move(op.groups), clustered_group_idx,
+			    op.estimated_cardinality);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.grouping_sets),
@@ -2,12 +2,15 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
@@ -15,6 +18,9 @@
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
@@ -129,6 +135,119 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+//! Finds an ART index on the scanned table that can be probed with the given join condition, if any
+static optional_ptr<ART> FindJoinIndex(ClientContext &context, PhysicalTableScan &scan, Expression &probe_key,
+                                       Expression &scan_key) {
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return nullptr;
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return nullptr;
+	}
+	if (scan.table_filters && !scan.table_filters->filters.empty()) {
+		// the scan is never executed, so its filters would be lost
+		return nullptr;
+	}
+	if (scan_key.type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	auto scan_column = scan_key.Cast<BoundReferenceExpression>().index;
+	if (!scan.projection_ids.empty()) {
+		scan_column = scan.projection_ids[scan_column];
+	}
+	const auto column_id = scan.column_ids[scan_column];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	auto &table = bind_data.table;
+	const auto storage_id = table.GetColumn(LogicalIndex(column_id)).StorageOid();
+
+	// only the indexes of constraints are also maintained for the transaction-local storage
+	optional_ptr<ART> result;
+	auto &info = table.GetStorage().GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+		if (art.GetConstraintType() == IndexConstraintType::NONE || art.GetColumnIds().size() != 1 ||
+		    art.GetColumnIds()[0] != storage_id ||
+		    art.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+		    art.logical_types[0] != probe_key.return_type) {
+			return false;
+		}
+		result = &art;
+		return true;
+	});
+	return result;
+}
+
+//! Plans an index join if one side of an inner equi-join is a scan of a large table with an index on the join key,
+//! and the other side is small enough for looking up its keys in the index to be cheaper than scanning the table
+static unique_ptr<PhysicalOperator> TryPlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                     unique_ptr<PhysicalOperator> &left,
+                                                     unique_ptr<PhysicalOperator> &right) {
+	static constexpr const idx_t INDEX_JOIN_THRESHOLD = 1000;
+	if (op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN || op.join_type != JoinType::INNER ||
+	    op.conditions.size() != 1 || op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	const auto force_index_join = ClientConfig::GetConfig(context).force_index_join;
+	auto &cond = op.conditions[0];
+	// prefer probing the RHS, i.e. keep the LHS as the probe side
+	for (auto table_is_left : {false, true}) {
+		auto &probe = !table_is_left ? left : right;
+		auto &table_op = !table_is_left ? right : left;
+		if (table_op->type != PhysicalOperatorType::TABLE_SCAN) {
+			continue;
+		}
+		if (!force_index_join &&
+		    probe->estimated_cardinality * INDEX_JOIN_THRESHOLD > table_op->estimated_cardinality) {
+			continue;
+		}
+		auto &probe_key = !table_is_left ? *cond.left : *cond.right;
+		auto &scan_key = !table_is_left ? *cond.right : *cond.left;
+		auto &scan = table_op->Cast<PhysicalTableScan>();
+		auto index = FindJoinIndex(context, scan, probe_key, scan_key);
+		if (!index) {
+			continue;
+		}
+
+		// the columns of the scan that are part of the join result are fetched from the table, followed by the row id
+		auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+		auto &probe_projection_map = !table_is_left ? op.left_projection_map : op.right_projection_map;
+		auto fetch_projection_map = !table_is_left ? op.right_projection_map : op.left_projection_map;
+		if (fetch_projection_map.empty()) {
+			for (idx_t col_idx = 0; col_idx < scan.types.size(); col_idx++) {
+				fetch_projection_map.push_back(col_idx);
+			}
+		}
+		vector<column_t> fetch_ids;
+		vector<LogicalType> fetch_types;
+		for (auto &col_idx : fetch_projection_map) {
+			const auto scan_column = scan.projection_ids.empty() ? col_idx : scan.projection_ids[col_idx];
+			const auto column_id = scan.column_ids[scan_column];
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			} else {
+				fetch_ids.push_back(table.GetColumn(LogicalIndex(column_id)).StorageOid());
+			}
+			fetch_types.push_back(scan.types[col_idx]);
+		}
+		fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		fetch_types.push_back(LogicalType::ROW_TYPE);
+
+		// the probe side always is the LHS of the index join
+		if (table_is_left) {
+			std::swap(cond.left, cond.right);
+		}
+		vector<JoinCondition> conditions;
+		conditions.push_back(std::move(cond));
+		return make_uniq<PhysicalIndexJoin>(op, std::move(probe), std::move(table_op), std::move(conditions),
+		                                    op.join_type, probe_projection_map, std::move(fetch_ids),
+		                                    std::move(fetch_types), table_is_left, table, *index,
+		                                    op.estimated_cardinality);
+	}
+	return nullptr;
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -190,6 +309,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		plan = TryPlanIndexJoin(context, op, left, right);
+		if (plan) {
+			return plan;
+		}
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
@@ -228,12 +351,133 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	return plan;
 }
 
+//! Finds the table scan that produces the given column of the probe side, looking through operators that are
+//! executed in the same pipeline as the scan and that pass the column through unmodified
+static optional_ptr<PhysicalTableScan> FindProbeScan(PhysicalOperator &op, idx_t column_index,
+                                                     idx_t &scan_column_index) {
+	switch (op.type) {
+	case PhysicalOperatorType::PROJECTION: {
+		auto &projection = op.Cast<PhysicalProjection>();
+		auto &expr = *projection.select_list[column_index];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		auto &ref = expr.Cast<BoundReferenceExpression>();
+		return FindProbeScan(*op.children[0], ref.index, scan_column_index);
+	}
+	case PhysicalOperatorType::FILTER:
+		return FindProbeScan(*op.children[0], column_index, scan_column_index);
+	case PhysicalOperatorType::HASH_JOIN: {
+		// the probe side of another hash join: tuples that are removed early can only remove their own join results
+		auto &join = op.Cast<PhysicalHashJoin>();
+		if (join.join_type == JoinType::RIGHT_SEMI || join.join_type == JoinType::RIGHT_ANTI) {
+			// these only emit the build side
+			return nullptr;
+		}
+		if (column_index >= join.children[0]->types.size()) {
+			// a column from the build side
+			return nullptr;
+		}
+		return FindProbeScan(*op.children[0], column_index, scan_column_index);
+	}
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (scan.function.name != "seq_scan" || !scan.function.filter_pushdown) {
+			// only our own storage initializes its filters when the scan starts (after the build has finished)
+			return nullptr;
+		}
+		auto scan_column = column_index;
+		if (!scan.projection_ids.empty() && scan.projection_ids.size() != scan.column_ids.size()) {
+			scan_column = scan.projection_ids[column_index];
+		}
+		if (scan.column_ids[scan_column] == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+		scan_column_index = scan_column;
+		return &scan;
+	}
+	default:
+		return nullptr;
+	}
+}
+
+void PhysicalPlanGenerator::PlanJoinFilterPushdown(PhysicalHashJoin &join) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.disabled_optimizers.find(OptimizerType::JOIN_FILTER_PUSHDOWN) !=
+	    config.options.disabled_optimizers.end()) {
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		// probe-side tuples without a match do not produce any output
+		break;
+	default:
+		return;
+	}
+	auto pushdown = make_uniq<JoinFilterPushdownInfo>();
+	optional_ptr<PhysicalTableScan> probe_scan;
+	idx_t equality_count = 0;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison == ExpressionType::COMPARE_EQUAL ||
+		    cond.comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			equality_count++;
+		}
+		// NULL values can match with NOT DISTINCT FROM, so we can only push filters for regular equality
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		auto &key_type = cond.left->return_type;
+		if (key_type.IsNested()) {
+			continue;
+		}
+		idx_t scan_column_index;
+		auto scan = FindProbeScan(*join.children[0], cond.left->Cast<BoundReferenceExpression>().index,
+		                          scan_column_index);
+		if (!scan || (probe_scan && scan.get() != probe_scan.get())) {
+			continue;
+		}
+		probe_scan = scan;
+		const auto push_min_max = TypeIsIntegral(key_type.InternalType());
+		pushdown->columns.push_back({cond_idx, scan_column_index, push_min_max});
+	}
+	if (pushdown->columns.empty()) {
+		return;
+	}
+	// the hash of the keys only matches the hash of the scanned column if there is a single equality condition
+	pushdown->push_bloom_filter = equality_count == 1 && pushdown->columns[0].join_condition == 0;
+	if (!pushdown->push_bloom_filter) {
+		auto &columns = pushdown->columns;
+		columns.erase(std::remove_if(columns.begin(), columns.end(),
+		                             [](const JoinFilterPushdownInfo::PushdownColumn &column) {
+			                             return !column.push_min_max;
+		                             }),
+		              columns.end());
+		if (columns.empty()) {
+			return;
+		}
+	}
+	if (!probe_scan->dynamic_filters) {
+		probe_scan->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	pushdown->dynamic_filters = probe_scan->dynamic_filters;
+	join.filter_pushdown = std::move(pushdown);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparisonJoin &op) {
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_ASOF_JOIN:
 		return PlanAsOfJoin(op);
-	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		return PlanComparisonJoin(op);
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		auto plan = PlanComparisonJoin(op);
+		if (plan->type == PhysicalOperatorType::HASH_JOIN) {
+			PlanJoinFilterPushdown(plan->Cast<PhysicalHashJoin>());
+		}
+		return plan;
+	}
 	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
 		return PlanDelimJoin(op);
 	default:
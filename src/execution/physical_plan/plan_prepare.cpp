@@ -13,6 +13,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalPrepare &o
 		auto plan = CreatePlan(*op.children[0]);
 		op.prepared->types = plan->types;
 		op.prepared->plan = std::move(plan);
+		if (require_rebind) {
+			op.prepared->properties.always_require_rebind = true;
+		}
 	}
 
 	return make_uniq<PhysicalPrepare>(op.name, std::move(op.prepared), op.estimated_cardinality);
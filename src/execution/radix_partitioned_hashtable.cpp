@@ -141,6 +141,12 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+
+	//! If at least this fraction of the rows sunk into a thread-local HT creates a new group, the HT is not reducing
+	//! the data, and the thread switches to appending the rows without pre-aggregating them
+	static constexpr const double PASS_THROUGH_NEW_GROUP_RATIO = 0.95;
+	//! Maximum number of consecutive HT fills that are passed through before we try to pre-aggregate again
+	static constexpr const idx_t MAXIMUM_PASS_THROUGH_FILLS = 16;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -329,9 +335,18 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Rows / newly created groups since the pointer table of the HT was last cleared
+	idx_t sink_count;
+	idx_t new_group_count;
+	//! Number of HT fills for which rows are appended without pre-aggregation (0 if we are pre-aggregating)
+	idx_t pass_through_fills;
+	//! Number of HT fills to pass through the next time pre-aggregation turns out not to reduce the data
+	idx_t next_pass_through_fills;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), new_group_count(0), pass_through_fills(0), next_pass_through_fills(1) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -447,18 +462,42 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
-
-	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
-		return; // We can fit another chunk
-	}
+	lstate.sink_count += group_chunk.size();
+	if (lstate.pass_through_fills != 0) {
+		// Pre-aggregation does not reduce the data, append the rows as-is (they are combined in Finalize)
+		ht.AppendChunk(group_chunk, payload_input, filter);
+		if (lstate.sink_count + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
+			return; // We would have been able to fit another chunk
+		}
+		lstate.sink_count = 0;
+		lstate.pass_through_fills--;
+	} else {
+		lstate.new_group_count += ht.AddChunk(group_chunk, payload_input, filter);
+		if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
+			return; // We can fit another chunk
+		}
 
-	if (gstate.number_of_threads > 2) {
-		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
-		// This only works because we never resize the HT
-		ht.ClearPointerTable();
-		ht.ResetCount();
-		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+		if (gstate.number_of_threads > 2) {
+			// 'Reset' the HT without taking its data, we can just keep appending to the same collection
+			// This only works because we never resize the HT
+			ht.ClearPointerTable();
+			ht.ResetCount();
+			// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+			// Duplicate groups are combined in Finalize anyway, so if (almost) every row created a new group, we might
+			// as well skip probing the HT for a while. Every time this happens in a row we skip probing for longer
+			const auto new_group_ratio =
+			    static_cast<double>(lstate.new_group_count) / static_cast<double>(lstate.sink_count);
+			if (new_group_ratio >= RadixHTConfig::PASS_THROUGH_NEW_GROUP_RATIO) {
+				lstate.pass_through_fills = lstate.next_pass_through_fills;
+				lstate.next_pass_through_fills =
+				    MinValue(lstate.next_pass_through_fills * 2, RadixHTConfig::MAXIMUM_PASS_THROUGH_FILLS);
+			} else {
+				lstate.next_pass_through_fills = 1;
+			}
+			lstate.sink_count = 0;
+			lstate.new_group_count = 0;
+		}
 	}
 
 	// Check if we need to repartition
@@ -897,6 +897,69 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool GetSlidingOffset(ClientContext &context, WindowBoundary boundary, const unique_ptr<Expression> &expr,
+                             int64_t &offset) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		offset = 0;
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		break;
+	default:
+		return false;
+	}
+
+	//	Invalid offsets are reported when the frames are computed
+	if (!expr || !expr->IsFoldable()) {
+		return false;
+	}
+	Value value;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, *expr, value) || value.IsNull() ||
+	    !value.DefaultTryCastAs(LogicalType::BIGINT)) {
+		return false;
+	}
+	offset = value.GetValue<int64_t>();
+	if (offset < 0 || offset > int64_t(WindowSlidingAggregator::MAXIMUM_FRAME_WIDTH)) {
+		return false;
+	}
+	if (boundary == WindowBoundary::EXPR_PRECEDING_ROWS) {
+		offset = -offset;
+	}
+	return true;
+}
+
+bool WindowAggregateExecutor::IsSlidingAggregate(idx_t &frame_width) {
+	if (!wexpr.aggregate || wexpr.distinct) {
+		return false;
+	}
+	// window exclusion cannot be handled by sliding aggregates
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	COUNT(*) is already handled efficiently by segment trees.
+	if (wexpr.children.empty()) {
+		return false;
+	}
+
+	//	The frame states are assembled by combining block states
+	if (!AggregateObject(wexpr).function.combine || mode >= WindowAggregationMode::SEPARATE) {
+		return false;
+	}
+
+	//	Only ROWS frames with constant offsets have a fixed width
+	int64_t start_offset;
+	int64_t end_offset;
+	if (!GetSlidingOffset(context, wexpr.start, wexpr.start_expr, start_offset) ||
+	    !GetSlidingOffset(context, wexpr.end, wexpr.end_expr, end_offset) || start_offset > end_offset) {
+		return false;
+	}
+
+	frame_width = UnsafeNumericCast<idx_t>(end_offset - start_offset + 1);
+	return frame_width <= WindowSlidingAggregator::MAXIMUM_FRAME_WIDTH;
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -917,6 +980,7 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 	const auto force_naive =
 	    !ClientConfig::GetConfig(context).enable_optimizer || mode == WindowAggregationMode::SEPARATE;
 	AggregateObject aggr(wexpr);
+	idx_t frame_width;
 	if (force_naive || (wexpr.distinct && wexpr.exclude_clause != WindowExcludeMode::NO_OTHER)) {
 		aggregator = make_uniq<WindowNaiveAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
 	} else if (IsDistinctAggregate()) {
@@ -928,6 +992,9 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsSlidingAggregate(frame_width)) {
+		// combine the prefix and suffix states of fixed-size blocks
+		aggregator = make_uniq<WindowSlidingAggregator>(aggr, wexpr.return_type, frame_width, count);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
@@ -1044,6 +1111,11 @@ void WindowAggregateExecutor::Finalize() {
 	aggregator->Finalize(stats);
 }
 
+bool WindowAggregateExecutor::HelpFinalize() {
+	D_ASSERT(aggregator);
+	return aggregator->HelpFinalize();
+}
+
 class WindowAggregateState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
@@ -6,6 +6,7 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 #include <utility>
@@ -599,7 +600,8 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
                                      const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p),
+      building(false), build_level(0), build_next(0), build_finished(0) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
@@ -846,38 +848,110 @@ void WindowSegmentTree::ConstructTree() {
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
 	idx_t level_nodes = inputs.size();
-	do {
+	levels_flat_start.push_back(0);
+	while (level_nodes > 1) {
 		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
 		internal_nodes += level_nodes;
-	} while (level_nodes > 1);
+		levels_flat_start.push_back(internal_nodes);
+	}
+
+	// Corner case: single element in the window
+	if (!internal_nodes) {
+		internal_nodes = 1;
+		levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
+		aggr.function.initialize(levels_flat_native.get());
+		return;
+	}
 	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
-	levels_flat_start.push_back(0);
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
+	//	The nodes of a level only depend on the level below,
+	//	so the levels are built one at a time, in tasks that other threads can help with.
+	const auto level_count = levels_flat_start.size() - 1;
+	build_level = 0;
+	build_next = 0;
+	build_finished = 0;
+	building = true;
+	while (build_level < level_count) {
+		if (!TryConstructTree(gtstate)) {
+			TaskScheduler::YieldThread();
+		}
+	}
+	building = false;
+}
+
+bool WindowSegmentTree::TryConstructTree(WindowSegmentTreePart &part) {
+	//	Claim a task on the current level
+	const auto level_count = levels_flat_start.size() - 1;
+	unique_lock<mutex> build_guard(build_lock);
+	const idx_t level_current = build_level;
+	if (level_current >= level_count) {
+		return false;
+	}
+	const auto level_nodes = levels_flat_start[level_current + 1] - levels_flat_start[level_current];
+	const auto level_tasks = (level_nodes + TREE_BUILD_NODES - 1) / TREE_BUILD_NODES;
+	if (build_next >= level_tasks) {
+		//	Wait for the other tasks of the level to finish
+		return false;
+	}
+	const auto node_begin = (build_next++) * TREE_BUILD_NODES;
+	build_guard.unlock();
+
 	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
+	const auto level_size =
+	    level_current == 0 ? inputs.size() : levels_flat_start[level_current] - levels_flat_start[level_current - 1];
+	const auto node_end = MinValue(node_begin + TREE_BUILD_NODES, level_nodes);
+	for (auto node = node_begin; node < node_end; ++node) {
+		// compute the aggregate for this entry in the segment tree
+		const auto pos = node * TREE_FANOUT;
+		data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_start[level_current] + node) * state_size;
+		aggr.function.initialize(state_ptr);
+		part.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
+	}
+	part.FlushStates(level_current > 0);
+
+	//	Move on to the next level when all tasks of this level are done
+	build_guard.lock();
+	if (++build_finished == level_tasks) {
+		build_next = 0;
+		build_finished = 0;
+		++build_level;
+	}
+
+	return true;
+}
+
+bool WindowSegmentTree::HelpFinalize() {
+	if (!building) {
+		return false;
+	}
+
+	//	Don't bother setting up a state if all the tasks of the current level have been claimed
+	{
+		lock_guard<mutex> build_guard(build_lock);
+		const idx_t level_current = build_level;
+		if (level_current + 1 >= levels_flat_start.size()) {
+			return false;
+		}
+		const auto level_nodes = levels_flat_start[level_current + 1] - levels_flat_start[level_current];
+		if (build_next * TREE_BUILD_NODES >= level_nodes) {
+			return false;
 		}
+	}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+	//	The nodes we build can reference memory of our allocator, so keep the state around
+	auto lstate = GetLocalState();
+	auto &part = lstate->Cast<WindowSegmentTreeState>().part;
+	bool helped = false;
+	while (TryConstructTree(part)) {
+		helped = true;
 	}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggr.function.initialize(levels_flat_native.get());
+	if (helped) {
+		lock_guard<mutex> build_guard(build_lock);
+		build_states.emplace_back(std::move(lstate));
 	}
+
+	return helped;
 }
 
 void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -1084,6 +1158,354 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTree &tree, const
 	FlushStates(false);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                 idx_t frame_width_p, idx_t count)
+    : WindowAggregator(std::move(aggr), result_type, WindowExcludeMode::NO_OTHER, count), frame_width(frame_width_p) {
+	D_ASSERT(frame_width > 0);
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+class WindowSlidingState : public WindowAggregatorState {
+public:
+	//! A block of (at most frame_width) rows of a partition
+	struct SlidingBlock {
+		SlidingBlock(idx_t begin, idx_t end, idx_t offset) : begin(begin), end(end), offset(offset) {
+		}
+		//! The rows of the block
+		idx_t begin;
+		idx_t end;
+		//! The position of the states of the first row of the block
+		idx_t offset;
+	};
+
+	//! The rows of a partition that are covered by the frames of a chunk
+	struct SlidingRun {
+		//! The start of the partition
+		idx_t partition_begin;
+		//! The index of the first block of the partition (in frame_width blocks from the partition start)
+		idx_t first_block_idx;
+		//! The index of that block in blocks
+		idx_t first_block;
+	};
+
+	explicit WindowSlidingState(const WindowSlidingAggregator &gstate);
+
+	void Evaluate(const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx);
+
+protected:
+	inline data_ptr_t PrefixState(idx_t position) {
+		return block_states.data() + position * gstate.state_size;
+	}
+	inline data_ptr_t SuffixState(idx_t position) {
+		return block_states.data() + (state_count + position) * gstate.state_size;
+	}
+	inline idx_t GetBlock(const SlidingRun &run, idx_t row) const {
+		return run.first_block + (row - run.partition_begin) / gstate.frame_width - run.first_block_idx;
+	}
+	inline idx_t GetPosition(const SlidingBlock &block, idx_t row) const {
+		return block.offset + row - block.begin;
+	}
+
+	//! Splits the rows that are covered by the frames into blocks
+	void InitializeBlocks(const DataChunk &bounds, idx_t count);
+	//! Computes the prefix and suffix states of the blocks
+	void ComputeBlockStates();
+	//! Buffers updating a state with an input row / combining a state into another state
+	void UpdateState(idx_t row, data_ptr_t state_ptr);
+	void CombineState(data_ptr_t source_ptr, data_ptr_t state_ptr);
+	//! Flushes the buffered updates / combines
+	void FlushUpdates();
+	void FlushCombines();
+	//! Destroys the block and result states
+	void DestroyStates(idx_t count);
+
+	//! The global state
+	const WindowSlidingAggregator &gstate;
+	//! The blocks of the current chunk
+	vector<SlidingBlock> blocks;
+	//! The run of each row of the current chunk
+	vector<SlidingRun> runs;
+	vector<idx_t> row_runs;
+	//! The number of positions in the blocks of the current chunk
+	idx_t state_count;
+	//! The prefix states followed by the suffix states of the blocks
+	vector<data_t> block_states;
+	//! The result states
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! A vector of pointers to the states that are updated / combined into
+	Vector statep;
+	//! A vector of pointers to the states that are combined
+	Vector statel;
+	//! Input data chunk, used for updating the states
+	DataChunk leaves;
+	//! The input rows that are updated
+	SelectionVector update_sel;
+	//! Count of buffered updates / combines
+	idx_t update_count;
+	idx_t combine_count;
+	//! A vector of pointers to the buffered updated states
+	Vector statec;
+};
+
+WindowSlidingState::WindowSlidingState(const WindowSlidingAggregator &gstate)
+    : gstate(gstate), state_count(0), state(gstate.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER),
+      statep(LogicalType::POINTER), statel(LogicalType::POINTER), update_count(0), combine_count(0),
+      statec(LogicalType::POINTER) {
+	auto &inputs = gstate.GetInputs();
+	if (inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+	update_sel.Initialize();
+	row_runs.resize(STANDARD_VECTOR_SIZE);
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += gstate.state_size;
+	}
+}
+
+void WindowSlidingState::UpdateState(idx_t row, data_ptr_t state_ptr) {
+	if (!gstate.GetFilterMask().RowIsValid(row)) {
+		return;
+	}
+	FlatVector::GetData<data_ptr_t>(statec)[update_count] = state_ptr;
+	update_sel.set_index(update_count++, row);
+	if (update_count >= STANDARD_VECTOR_SIZE) {
+		FlushUpdates();
+	}
+}
+
+void WindowSlidingState::CombineState(data_ptr_t source_ptr, data_ptr_t state_ptr) {
+	FlatVector::GetData<data_ptr_t>(statel)[combine_count] = source_ptr;
+	FlatVector::GetData<data_ptr_t>(statep)[combine_count++] = state_ptr;
+	if (combine_count >= STANDARD_VECTOR_SIZE) {
+		FlushCombines();
+	}
+}
+
+void WindowSlidingState::FlushUpdates() {
+	if (!update_count) {
+		return;
+	}
+
+	auto &aggr = gstate.aggr;
+	leaves.Slice(gstate.GetInputs(), update_sel, update_count);
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statec, update_count);
+
+	update_count = 0;
+}
+
+void WindowSlidingState::FlushCombines() {
+	if (!combine_count) {
+		return;
+	}
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(statel, statep, aggr_input_data, combine_count);
+
+	combine_count = 0;
+}
+
+void WindowSlidingState::InitializeBlocks(const DataChunk &bounds, idx_t count) {
+	auto partition_begin = FlatVector::GetData<const idx_t>(bounds.data[PARTITION_BEGIN]);
+	auto partition_end = FlatVector::GetData<const idx_t>(bounds.data[PARTITION_END]);
+	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	//	The frames of a partition are contained in the partition,
+	//	so we can split the rows covered by the frames of a partition into blocks that start at the partition begin
+	const auto frame_width = gstate.frame_width;
+	blocks.clear();
+	runs.clear();
+	state_count = 0;
+	for (idx_t rid = 0; rid < count;) {
+		const auto begin = partition_begin[rid];
+		const auto end = partition_end[rid];
+		idx_t lo = end;
+		idx_t hi = begin;
+		const auto run_idx = runs.size();
+		for (; rid < count && partition_begin[rid] == begin; ++rid) {
+			row_runs[rid] = run_idx;
+			if (window_begin[rid] < window_end[rid]) {
+				lo = MinValue(lo, window_begin[rid]);
+				hi = MaxValue(hi, window_end[rid]);
+			}
+		}
+
+		const auto first_block_idx = lo < hi ? (lo - begin) / frame_width : 0;
+		runs.emplace_back(SlidingRun {begin, first_block_idx, blocks.size()});
+		for (auto block_begin = begin + first_block_idx * frame_width; block_begin < hi; block_begin += frame_width) {
+			const auto block_end = MinValue(block_begin + frame_width, hi);
+			blocks.emplace_back(block_begin, block_end, state_count);
+			state_count += block_end - block_begin;
+		}
+	}
+
+	//	Initialise the prefix and suffix states
+	const auto state_size = gstate.state_size;
+	if (block_states.size() < 2 * state_count * state_size) {
+		block_states.resize(2 * state_count * state_size);
+	}
+	auto &aggr = gstate.aggr;
+	for (idx_t i = 0; i < 2 * state_count; ++i) {
+		aggr.function.initialize(block_states.data() + i * state_size);
+	}
+}
+
+void WindowSlidingState::ComputeBlockStates() {
+	const auto frame_width = gstate.frame_width;
+
+	//	The prefix states are computed one column of blocks at a time, which batches the rows of all blocks.
+	//	For order dependent aggregates, the previous prefix is combined before the row itself is added.
+	for (idx_t i = 0; i < frame_width; ++i) {
+		if (i > 0) {
+			for (auto &block : blocks) {
+				if (block.begin + i < block.end) {
+					CombineState(PrefixState(block.offset + i - 1), PrefixState(block.offset + i));
+				}
+			}
+			FlushCombines();
+		}
+		for (auto &block : blocks) {
+			if (block.begin + i < block.end) {
+				UpdateState(block.begin + i, PrefixState(block.offset + i));
+			}
+		}
+		FlushUpdates();
+	}
+
+	//	The suffix states are computed in reverse: the row itself is added before the next suffix is combined
+	for (idx_t i = frame_width; i-- > 0;) {
+		for (auto &block : blocks) {
+			if (block.begin + i < block.end) {
+				UpdateState(block.begin + i, SuffixState(block.offset + i));
+			}
+		}
+		FlushUpdates();
+		for (auto &block : blocks) {
+			if (block.begin + i + 1 < block.end) {
+				CombineState(SuffixState(block.offset + i + 1), SuffixState(block.offset + i));
+			}
+		}
+		FlushCombines();
+	}
+}
+
+void WindowSlidingState::Evaluate(const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) {
+	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	InitializeBlocks(bounds, count);
+	ComputeBlockStates();
+
+	auto &aggr = gstate.aggr;
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t rid = 0; rid < count; ++rid) {
+		aggr.function.initialize(fdata[rid]);
+	}
+
+	//	Every frame is either a prefix or a suffix of a block, or the suffix of a block followed by a prefix of the
+	//	next block. The (unexpected) frames that do not fit this are aggregated row by row.
+	for (idx_t rid = 0; rid < count; ++rid) {
+		const auto begin = window_begin[rid];
+		const auto end = window_end[rid];
+		if (begin >= end) {
+			continue;
+		}
+		auto &run = runs[row_runs[rid]];
+		auto &begin_block = blocks[GetBlock(run, begin)];
+		const auto end_block_idx = GetBlock(run, end - 1);
+		if (&begin_block == &blocks[end_block_idx]) {
+			if (begin == begin_block.begin) {
+				CombineState(PrefixState(GetPosition(begin_block, end - 1)), fdata[rid]);
+				continue;
+			} else if (end == begin_block.end) {
+				CombineState(SuffixState(GetPosition(begin_block, begin)), fdata[rid]);
+				continue;
+			}
+		} else if (&begin_block + 1 == &blocks[end_block_idx]) {
+			CombineState(SuffixState(GetPosition(begin_block, begin)), fdata[rid]);
+			continue;
+		}
+		for (auto row = begin; row < end; ++row) {
+			UpdateState(row, fdata[rid]);
+		}
+	}
+	FlushCombines();
+	FlushUpdates();
+
+	//	Add the prefixes of the frames that span two blocks
+	for (idx_t rid = 0; rid < count; ++rid) {
+		const auto begin = window_begin[rid];
+		const auto end = window_end[rid];
+		if (begin >= end) {
+			continue;
+		}
+		auto &run = runs[row_runs[rid]];
+		const auto begin_block_idx = GetBlock(run, begin);
+		const auto end_block_idx = GetBlock(run, end - 1);
+		if (begin_block_idx + 1 == end_block_idx) {
+			auto &end_block = blocks[end_block_idx];
+			CombineState(PrefixState(GetPosition(end_block, end - 1)), fdata[rid]);
+		}
+	}
+	FlushCombines();
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+
+	DestroyStates(count);
+}
+
+void WindowSlidingState::DestroyStates(idx_t count) {
+	auto &aggr = gstate.aggr;
+	if (!aggr.function.destructor) {
+		return;
+	}
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.destructor(statef, aggr_input_data, count);
+
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	idx_t destroy_count = 0;
+	for (idx_t i = 0; i < 2 * state_count; ++i) {
+		pdata[destroy_count++] = block_states.data() + i * gstate.state_size;
+		if (destroy_count == STANDARD_VECTOR_SIZE) {
+			aggr.function.destructor(statep, aggr_input_data, destroy_count);
+			destroy_count = 0;
+		}
+	}
+	if (destroy_count > 0) {
+		aggr.function.destructor(statep, aggr_input_data, destroy_count);
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState() const {
+	return make_uniq<WindowSlidingState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                       idx_t count, idx_t row_idx) const {
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Evaluate(bounds, result, count, row_idx);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowDistinctAggregator
 //===--------------------------------------------------------------------===//
@@ -19,6 +19,9 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("compression_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -46,6 +49,8 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		output.SetValue(col++, count, entry.path);
 		// database_oid, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// compression_ratio, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(entry.compression_ratio));
 		count++;
 	}
 	output.SetCardinality(count);
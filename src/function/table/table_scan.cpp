@@ -14,6 +14,7 @@
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/local_storage.hpp"
@@ -211,23 +212,30 @@ unique_ptr<NodeStatistics> TableScanCardinality(ClientContext &context, const Fu
 // Index Scan
 //===--------------------------------------------------------------------===//
 struct IndexScanGlobalState : public GlobalTableFunctionState {
-	explicit IndexScanGlobalState(data_ptr_t row_id_data) : row_ids(LogicalType::ROW_TYPE, row_id_data) {
+	IndexScanGlobalState() : row_ids(LogicalType::ROW_TYPE, nullptr) {
 	}
 
 	Vector row_ids;
+	//! The number of row ids that have been fetched
+	idx_t row_id_offset = 0;
 	ColumnFetchState fetch_state;
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
-	bool finished;
+	//! The filters that are applied to the fetched rows
+	optional_ptr<TableFilterSet> filters;
+
+	vector<idx_t> projection_ids;
+	//! The DataChunk containing all read columns (even filter columns that are immediately removed)
+	DataChunk all_columns;
+
+	bool CanRemoveFilterColumns() const {
+		return !projection_ids.empty();
+	}
 };
 
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
-	data_ptr_t row_id_data = nullptr;
-	if (!bind_data.result_ids.empty()) {
-		row_id_data = (data_ptr_t)&bind_data.result_ids[0]; // NOLINT - this is not pretty
-	}
-	auto result = make_uniq<IndexScanGlobalState>(row_id_data);
+	auto result = make_uniq<IndexScanGlobalState>();
 	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
 
 	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
@@ -239,23 +247,67 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
 	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
 
-	result->finished = false;
+	result->filters = input.filters.get();
+	if (input.CanRemoveFilterColumns()) {
+		result->projection_ids = input.projection_ids;
+		vector<LogicalType> scanned_types;
+		const auto &columns = bind_data.table.GetColumns();
+		for (const auto &col_idx : input.column_ids) {
+			if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+				scanned_types.emplace_back(LogicalType::ROW_TYPE);
+			} else {
+				scanned_types.push_back(columns.GetColumn(LogicalIndex(col_idx)).Type());
+			}
+		}
+		result->all_columns.Initialize(context, scanned_types);
+	}
 	return std::move(result);
 }
 
+//! Fetches the next batch of (at most STANDARD_VECTOR_SIZE) row ids, and applies the filters to the fetched rows
+static void IndexScanFetch(DuckTransaction &transaction, const TableScanBindData &bind_data,
+                           IndexScanGlobalState &state, DataChunk &output) {
+	auto &result_ids = bind_data.result_ids;
+	while (output.size() == 0 && state.row_id_offset < result_ids.size()) {
+		auto fetch_count = MinValue<idx_t>(result_ids.size() - state.row_id_offset, STANDARD_VECTOR_SIZE);
+		FlatVector::SetData(state.row_ids, (data_ptr_t)&result_ids[state.row_id_offset]); // NOLINT - this is not pretty
+		state.row_id_offset += fetch_count;
+
+		output.Reset();
+		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, state.row_ids, fetch_count,
+		                                   state.fetch_state);
+		if (!state.filters || output.size() == 0) {
+			continue;
+		}
+		SelectionVector sel;
+		idx_t approved_count = output.size();
+		for (auto &entry : state.filters->filters) {
+			auto &column = output.data[entry.first];
+			UnifiedVectorFormat vdata;
+			column.ToUnifiedFormat(output.size(), vdata);
+			ColumnSegment::FilterSelection(sel, column, vdata, *entry.second, output.size(), approved_count);
+		}
+		if (approved_count < output.size()) {
+			output.Slice(sel, approved_count);
+		}
+	}
+}
+
 static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &state = data_p.global_state->Cast<IndexScanGlobalState>();
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &local_storage = LocalStorage::Get(transaction);
 
-	if (!state.finished) {
-		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, state.row_ids,
-		                                   bind_data.result_ids.size(), state.fetch_state);
-		state.finished = true;
+	auto &result = state.CanRemoveFilterColumns() ? state.all_columns : output;
+	result.Reset();
+	// the row ids of the index are sorted, so the rows are fetched in batches in the order of the table
+	IndexScanFetch(transaction, bind_data, state, result);
+	if (result.size() == 0) {
+		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, result);
 	}
-	if (output.size() == 0) {
-		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+	if (state.CanRemoveFilterColumns()) {
+		output.ReferenceColumns(state.all_columns, state.projection_ids);
 	}
 }
 
@@ -294,15 +346,6 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	if (bind_data.is_index_scan) {
 		return;
 	}
-	if (!get.table_filters.filters.empty()) {
-		// if there were filters before we can't convert this to an index scan
-		return;
-	}
-	if (!get.projection_ids.empty()) {
-		// if columns were pruned by RemoveUnusedColumns we can't convert this to an index scan,
-		// because index scan does not support filter_prune (yet)
-		return;
-	}
 	if (filters.empty()) {
 		// no indexes or no filters: skip the pushdown
 		return;
@@ -312,37 +355,44 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	auto &info = storage.GetDataTableInfo();
 	auto &transaction = Transaction::Get(context, bind_data.table.catalog);
 
+	// an index scan is used if it returns at most index_scan_max_count rows, or a small fraction of the table
+	auto total_rows = storage.GetTotalRows();
+	auto max_count =
+	    MaxValue<idx_t>(config.index_scan_max_count,
+	                    static_cast<idx_t>(config.index_scan_percentage * static_cast<double>(total_rows)));
+
 	// bind and scan any ART indexes
 	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
-		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
+		// first rewrite the index expressions so the ColumnBindings align with the column bindings of the current
+		// table, a prefix of the key columns can be used to scan compound keys
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				// could not rewrite!
+				break;
+			}
+			index_expressions.push_back(std::move(index_expression));
+		}
+		if (index_expressions.empty()) {
 			return false;
 		}
 
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
+		// try to find matching predicates for the key columns in the filter expressions
+		auto index_state = art_index.TryInitializeScan(transaction, index_expressions, filters);
+		if (!index_state) {
 			return false;
 		}
-
-		// try to find a matching index for any of the filter expressions
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(transaction, *index_expression, *filter);
-			if (index_state != nullptr) {
-				if (art_index.Scan(transaction, storage, *index_state, STANDARD_VECTOR_SIZE, bind_data.result_ids)) {
-					// use an index scan!
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-				} else {
-					bind_data.result_ids.clear();
-				}
-				return true;
-			}
+		if (art_index.Scan(transaction, storage, *index_state, max_count, bind_data.result_ids)) {
+			// use an index scan!
+			bind_data.is_index_scan = true;
+			get.function = TableScanFunction::GetIndexScanFunction();
+		} else {
+			bind_data.result_ids.clear();
 		}
-		return false;
+		return true;
 	});
 }
 
@@ -391,7 +441,8 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	scan_function.table_scan_progress = nullptr;
 	scan_function.get_batch_index = nullptr;
 	scan_function.projection_pushdown = true;
-	scan_function.filter_pushdown = false;
+	scan_function.filter_pushdown = true;
+	scan_function.filter_prune = true;
 	scan_function.get_bind_info = TableScanGetBindInfo;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
@@ -68,6 +68,7 @@ public:
 	DUCKDB_API void Truncate(int64_t new_size);
 	DUCKDB_API string ReadLine();
 	DUCKDB_API bool Trim(idx_t offset_bytes, idx_t length_bytes);
+	DUCKDB_API bool ReadAhead(idx_t location, idx_t nr_bytes);
 
 	DUCKDB_API bool CanSeek();
 	DUCKDB_API bool IsPipe();
@@ -124,6 +125,9 @@ public:
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
+	//! Hint that a range of the file will be read soon. File systems with a high access latency (e.g. remote files)
+	//! can start fetching the range in the background. Returns false if the hint is ignored.
+	DUCKDB_API virtual bool ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes);
 
 	//! Returns the file size of a file handle, returns -1 on error
 	DUCKDB_API virtual int64_t GetFileSize(FileHandle &handle);
@@ -0,0 +1,16 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+//! Hint to the CPU that the cache line containing "addr" will be read soon
+#if __GNUC__
+#define DUCKDB_PREFETCH(addr) (__builtin_prefetch(addr))
+#else
+#define DUCKDB_PREFETCH(addr) ((void)(addr))
+#endif
@@ -51,6 +51,21 @@ public:
 	unordered_map<idx_t, idx_t> sorting_to_blob_col;
 };
 
+//! Progress of the Merge Path partitions of a pair of sorted blocks that are merged in a round
+struct MergePathPairState {
+	//! The number of partitions (each producing up to block_capacity rows) of the merged pair
+	idx_t partition_count = 0;
+	//! The next partition to hand out
+	idx_t partition_idx = 0;
+	//! Whether each partition has been merged, and the intersection at its end
+	vector<bool> partition_done;
+	vector<pair<idx_t, idx_t>> partition_ends;
+	//! Partitions [0, finished_count) have been merged, i.e., rows before (l_finished, r_finished) are no longer needed
+	idx_t finished_count = 0;
+	idx_t l_finished = 0;
+	idx_t r_finished = 0;
+};
+
 struct GlobalSortState {
 public:
 	GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders, RowLayout &payload_layout);
@@ -94,8 +109,7 @@ public:
 	//! Progress in merge path stage
 	idx_t pair_idx;
 	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	vector<MergePathPairState> pair_states;
 };
 
 struct LocalSortState {
@@ -170,9 +184,26 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The pair and partition that is being merged
+	idx_t pair_idx;
+	idx_t partition_idx;
+	//! Global index of the first row of left_input/right_input in the pair of sorted blocks
+	idx_t l_offset;
+	idx_t r_offset;
+	//! Rows before these indices (in left_input/right_input) are known to come before the intersection
+	idx_t l_bound;
+	idx_t r_bound;
+	//! The intersection at the end of the partition (global index in the pair of sorted blocks)
+	idx_t l_end;
+	idx_t r_end;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Claims the next partition and takes a reference to the data that it can be found in (requires the lock)
 	void GetNextPartition();
+	//! Computes the left and right slices that must be merged for the claimed partition (Merge Path)
+	void SlicePartition();
+	//! Marks the claimed partition as merged (requires the lock)
+	void FinishPartition();
 	//! Finds the boundary of the next partition using binary search
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
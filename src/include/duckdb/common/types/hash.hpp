@@ -66,4 +66,18 @@ DUCKDB_API hash_t Hash(interval_t val);
 DUCKDB_API hash_t Hash(const char *val, size_t size);
 DUCKDB_API hash_t Hash(uint8_t *val, size_t size);
 
+//! Same as Hash, but the 64-bit integer hashes are inlined so that tight hashing loops can be auto-vectorized
+template <class T>
+inline hash_t InlineHash(T value) {
+	return Hash<T>(value);
+}
+template <>
+inline hash_t InlineHash(uint64_t value) {
+	return MurmurHash64(value);
+}
+template <>
+inline hash_t InlineHash(int64_t value) {
+	return MurmurHash64(static_cast<uint64_t>(value));
+}
+
 } // namespace duckdb
@@ -20,6 +20,9 @@ namespace duckdb {
 
 enum class HLLStorageType : uint8_t { UNCOMPRESSED = 1 };
 
+//! The encodings of the compact representation of a HLL
+enum class HLLCompactEncoding : uint8_t { SPARSE = 1, DENSE = 2 };
+
 class Serializer;
 class Deserializer;
 
@@ -50,6 +53,14 @@ public:
 	void Serialize(Serializer &serializer) const;
 	static unique_ptr<HyperLogLog> Deserialize(Deserializer &deserializer);
 
+	//! Get the size (in bytes) of the compact representation of the HLL
+	idx_t GetCompactSize() const;
+	//! Write the compact representation of the HLL (e.g., to store it in a BLOB). Only the registers that are set are
+	//! written if there are few of them, the registers are bit-packed otherwise.
+	void WriteCompact(data_ptr_t target) const;
+	//! Merge a HLL in its compact representation into this HLL
+	void MergeCompact(const_data_ptr_t source, idx_t size);
+
 public:
 	//! Compute HLL hashes over vdata, and store them in 'hashes'
 	//! Then, compute register indices and prefix lengths, and also store them in 'hashes' as a pair of uint32_t
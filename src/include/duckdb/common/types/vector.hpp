@@ -11,6 +11,7 @@
 #include "duckdb/common/bitset.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/vector_type.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -144,6 +145,8 @@ public:
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count);
 	//! Slice the vector, keeping the result around in a cache or potentially using the cache instead of slicing
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count, SelCache &cache);
+	//! Turns the vector into a dictionary vector over a flat dictionary with a known number of entries
+	DUCKDB_API void Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count);
 
 	//! Creates the data of this vector with the specified type. Any data that
 	//! is currently in the vector is destroyed.
@@ -263,6 +266,8 @@ public:
 
 public:
 	Vector data;
+	//! The number of entries in "data" if it is the dictionary of a dictionary vector and the size is known
+	optional_idx size;
 };
 
 struct ConstantVector {
@@ -318,6 +323,11 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! Returns the number of entries in the dictionary, if it is known (i.e. the dictionary was emitted by a scan)
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.auxiliary->Cast<VectorChildBuffer>().size;
+	}
 };
 
 struct FlatVector {
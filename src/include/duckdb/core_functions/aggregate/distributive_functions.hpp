@@ -147,6 +147,33 @@ struct EntropyFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct HllCardinalityFun {
+	static constexpr const char *Name = "hll_cardinality";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Returns the approximate count of distinct elements of a HyperLogLog sketch.";
+	static constexpr const char *Example = "hll_cardinality(hll_create(A))";
+
+	static ScalarFunction GetFunction();
+};
+
+struct HllCreateFun {
+	static constexpr const char *Name = "hll_create";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Creates a HyperLogLog sketch of the distinct elements, which can be merged with hll_merge.";
+	static constexpr const char *Example = "hll_create(A)";
+
+	static AggregateFunctionSet GetFunctions();
+};
+
+struct HllMergeFun {
+	static constexpr const char *Name = "hll_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges HyperLogLog sketches created by hll_create into a single sketch.";
+	static constexpr const char *Example = "hll_merge(A)";
+
+	static AggregateFunction GetFunction();
+};
+
 struct KahanSumFun {
 	static constexpr const char *Name = "kahan_sum";
 	static constexpr const char *Parameters = "arg";
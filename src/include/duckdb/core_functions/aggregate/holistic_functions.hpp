@@ -75,6 +75,24 @@ struct QuantileContFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct QuantileSketchAggFun {
+	static constexpr const char *Name = "quantile_sketch_agg";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Creates a t-digest sketch of the values, from which quantiles can be computed with sketch_quantile.";
+	static constexpr const char *Example = "quantile_sketch_agg(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct QuantileSketchMergeFun {
+	static constexpr const char *Name = "quantile_sketch_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges quantile sketches created by quantile_sketch_agg into a single sketch.";
+	static constexpr const char *Example = "quantile_sketch_merge(A)";
+
+	static AggregateFunction GetFunction();
+};
+
 struct ReservoirQuantileFun {
 	static constexpr const char *Name = "reservoir_quantile";
 	static constexpr const char *Parameters = "x,quantile,sample_size";
@@ -84,4 +102,13 @@ struct ReservoirQuantileFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct SketchQuantileFun {
+	static constexpr const char *Name = "sketch_quantile";
+	static constexpr const char *Parameters = "sketch,quantile";
+	static constexpr const char *Description = "Computes the approximate quantile of a quantile sketch created by quantile_sketch_agg.";
+	static constexpr const char *Example = "sketch_quantile(quantile_sketch_agg(A),0.99)";
+
+	static ScalarFunction GetFunction();
+};
+
 } // namespace duckdb
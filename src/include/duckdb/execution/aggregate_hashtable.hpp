@@ -110,6 +110,9 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, AggregateType filter);
+	//! Append the given data to the HT without probing the pointer table: every row becomes a new group (which may
+	//! duplicate an existing group). The pointer table and the group count are left untouched.
+	void AppendChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Fetch the aggregates for specific groups from the HT and place them in the result
 	void FetchAggregates(DataChunk &groups, DataChunk &result);
@@ -171,6 +174,8 @@ private:
 
 	//! Predicates for matching groups (always ExpressionType::COMPARE_EQUAL)
 	vector<ExpressionType> predicates;
+	//! Whether the groups are one or two 32/64-bit integer columns, which are hashed and matched inline
+	bool inline_keys;
 
 	//! The number of groups in the HT
 	idx_t count;
@@ -198,6 +203,17 @@ private:
 	//! Apply bitmask to get the entry in the HT
 	inline idx_t ApplyBitMask(hash_t hash) const;
 
+	//! References the groups and hashes in the group chunk of the append state and converts it to unified format
+	void InitializeGroupChunk(DataChunk &groups, Vector &group_hashes);
+	//! Updates the aggregate states at the addresses in the append state with the payload
+	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
+
+	//! Hashes the groups, using a single fused loop over the keys if they are inline keys
+	void HashGroups(DataChunk &groups, Vector &hashes);
+	//! Matches inline keys against the rows at the addresses, same interface as RowMatcher::Match
+	idx_t MatchInlineKeys(SelectionVector &sel, idx_t count, Vector &addresses, SelectionVector &no_match_sel,
+	                      idx_t &no_match_count);
+
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
@@ -53,9 +53,12 @@ public:
 	//! True, if the ART owns its data
 	bool owns_data;
 
-	//! Try to initialize a scan on the index with the given expression and filter
-	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-	                                             const Expression &filter_expr);
+	//! Try to initialize a scan on the index with the given filters. The index expressions are the (rewritten) key
+	//! expressions of a prefix of the key columns. Equality predicates on leading key columns are followed by at most
+	//! one range predicate
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
 
 	//! Performs a lookup on the index, fetching up to max_count result IDs. Returns true if all row IDs were fetched,
 	//! and false otherwise
@@ -85,6 +88,8 @@ public:
 
 	//! Construct an ART from a vector of sorted keys
 	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
+	//! Construct an ART from a vector of sorted keys and their row IDs
+	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, row_t *row_ids);
 
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
@@ -98,6 +103,15 @@ public:
 	//! index must also be locked during the merge
 	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
 
+	//! Returns the buffer ID offsets of each of the other ARTs, if they are merged into this ART in order.
+	//! All ARTs must own their allocators
+	vector<ARTFlags> InitializeMerges(const vector<reference<ART>> &others);
+	//! Shifts the buffer IDs of all nodes of this ART by the offsets returned by InitializeMerges. The other ARTs of a
+	//! merge can be prepared in parallel
+	void PrepareMerge(const ARTFlags &flags);
+	//! Merges the prepared other ARTs into this ART, in the order passed to InitializeMerges
+	bool MergePrepared(const vector<reference<ART>> &others);
+
 	//! Traverses an ART and vacuums the qualifying nodes. The lock obtained from InitializeLock must be held
 	void Vacuum(IndexLock &state) override;
 
@@ -119,6 +133,9 @@ public:
 
 	//! Find the node with a matching key, or return nullptr if not found
 	optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
+	//! Find the leaves of the first count keys, or empty nodes for keys that are not found. The keys are traversed
+	//! level by level, and the next node of each key is prefetched while the nodes of the other keys are traversed
+	void Lookup(const vector<ARTKey> &keys, const idx_t count, vector<Node> &leaves);
 	//! Insert a key into the tree
 	bool Insert(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
@@ -17,6 +17,7 @@
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -108,6 +109,8 @@ public:
 		void InitializeSelectionVector(const SelectionVector *&current_sel);
 		void AdvancePointers();
 		void AdvancePointers(const SelectionVector &sel, idx_t sel_count);
+		//! Prefetch the rows the pointers point to (if the HT is too large to fit in the CPU caches)
+		void PrefetchRows();
 		void GatherResult(Vector &result, const SelectionVector &result_vector, const SelectionVector &sel_vector,
 		                  const idx_t count, const idx_t col_idx);
 		void GatherResult(Vector &result, const SelectionVector &sel_vector, const idx_t count, const idx_t col_idx);
@@ -127,6 +130,8 @@ public:
 	void Unpartition();
 	//! Initialize the pointer table for the probe
 	void InitializePointerTable();
+	//! Initialize a Bloom filter over the hashes of the keys, which is filled during Finalize
+	void InitializeBloomFilter();
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
@@ -190,6 +195,10 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Whether or not to prefetch buckets and rows while probing (set if the HT does not fit in the CPU caches)
+	bool prefetch;
+	//! Bloom filter over the hashes of the keys (only built if InitializeBloomFilter was called)
+	unique_ptr<BloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -301,6 +310,9 @@ public:
 		return partition_end;
 	}
 
+	//! The HT size (in bytes) from which on we prefetch while probing
+	static constexpr const idx_t PREFETCH_THRESHOLD = 4ULL * 1024ULL * 1024ULL;
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate performs a group-by on input that is clustered on one of the groups, i.e. where the
+//! batches of the input (row groups of a table) cover disjoint ranges of that group. Every thread only keeps the
+//! groups of the batch it is currently scanning, in a small hash table that is only probed once per run of identical
+//! groups. When a batch is done, the groups that lie strictly within the range of the batch are complete and are
+//! finalized right away. Only the groups at the boundaries of a batch can also occur in other batches, these are
+//! merged across threads.
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(ClientContext &context, vector<LogicalType> types,
+	                           vector<unique_ptr<Expression>> aggregates, vector<unique_ptr<Expression>> groups,
+	                           idx_t clustered_group_idx, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+	//! The group the input is clustered on
+	idx_t clustered_group_idx;
+
+	//! The group types
+	vector<LogicalType> group_types;
+	//! The payload types
+	vector<LogicalType> payload_types;
+	//! The aggregates as bound aggregate expressions
+	vector<BoundAggregateExpression *> bindings;
+	//! The layout of the groups and their aggregate states in the hash tables
+	TupleDataLayout layout;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+	OrderPreservationType SourceOrder() const override {
+		return OrderPreservationType::NO_ORDER;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	string ParamsToString() const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	bool SinkOrderDependent() const override {
+		return false;
+	}
+
+	//! The batch index tells us which groups of a thread can still occur in other threads
+	bool RequiresBatchIndex() const override {
+		return true;
+	}
+};
+
+} // namespace duckdb
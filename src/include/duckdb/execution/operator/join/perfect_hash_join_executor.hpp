@@ -12,6 +12,7 @@
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/execution/join_hashtable.hpp"
 #include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -45,6 +46,8 @@ public:
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
 	bool BuildPerfectHashTable(LogicalType &type);
+	//! Creates a Bloom filter over the keys in the build range, or nullptr if the range is dense
+	unique_ptr<BloomFilter> CreateBloomFilter(const LogicalType &key_type);
 
 private:
 	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
@@ -59,6 +62,8 @@ private:
 	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
 	                                       idx_t count);
 	bool FullScanHashTable(LogicalType &key_type);
+	template <typename T>
+	void TemplatedFillBloomFilter(const LogicalType &key_type, BloomFilter &bloom_filter);
 
 private:
 	const PhysicalHashJoin &join;
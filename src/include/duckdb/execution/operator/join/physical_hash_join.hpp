@@ -17,6 +17,29 @@
 
 namespace duckdb {
 
+//! JoinFilterPushdownInfo describes the runtime filters a hash join pushes into the table scan on its probe side
+//! once the build side has been finalized: min/max filters on the join keys, and a Bloom filter for single-key joins
+struct JoinFilterPushdownInfo {
+	struct PushdownColumn {
+		//! The index of the join condition the filter is derived from
+		idx_t join_condition;
+		//! The index of the column in the column_ids of the probe-side table scan
+		idx_t probe_column_index;
+		//! Whether we can push min/max filters for this column
+		bool push_min_max;
+	};
+
+	//! The join key columns that filters are pushed into
+	vector<PushdownColumn> columns;
+	//! Whether we push a Bloom filter on the (single) join key
+	bool push_bloom_filter = false;
+	//! The dynamic filters of the probe-side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+
+	//! The maximum build side size for which we construct a Bloom filter
+	static constexpr const idx_t BLOOM_FILTER_MAX_BUILD_SIZE = 1 << 22;
+};
+
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
@@ -33,6 +56,10 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! Push the min/max filters of the build side keys into the probe side (if filter pushdown is enabled)
+	void PushJoinFilters(GlobalSinkState &sink) const;
+	//! Push the Bloom filter of the finalized hash table into the probe side (if one was built)
+	void PushBloomFilter(JoinHashTable &ht) const;
 
 	//! The types of the join keys
 	vector<LogicalType> condition_types;
@@ -51,6 +78,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Runtime filters pushed into the probe side (if any)
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
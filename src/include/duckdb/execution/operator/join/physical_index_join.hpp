@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+class ART;
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an index nested loop join: for every row of the probe side (children[0]), the matching
+//! rows of a base table (children[1]) are looked up in an ART index on the join key, and then fetched from the table.
+//! The table scan child is never executed.
+class PhysicalIndexJoin : public PhysicalComparisonJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	                  vector<JoinCondition> cond, JoinType join_type, const vector<idx_t> &probe_projection_map,
+	                  vector<column_t> fetch_ids, vector<LogicalType> fetch_types, bool fetched_columns_first,
+	                  DuckTableEntry &table, ART &index, idx_t estimated_cardinality);
+
+	//! The probe columns that are part of the output
+	vector<idx_t> probe_projection_map;
+	//! The storage ids of the table columns that are fetched, the last one is always the row id
+	vector<column_t> fetch_ids;
+	//! The types of the fetched columns
+	vector<LogicalType> fetch_types;
+	//! Whether the fetched columns come before the probe columns in the output, i.e. the table is the LHS of the join
+	bool fetched_columns_first;
+	//! The table that is probed
+	DuckTableEntry &table;
+	//! The index on the join key of the table
+	ART &index;
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	// CachingOperator Interface
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+	vector<const_reference<PhysicalOperator>> GetSources() const override;
+};
+
+} // namespace duckdb
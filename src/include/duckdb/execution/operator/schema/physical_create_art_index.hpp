@@ -56,10 +56,15 @@ public:
 
 	//! Sink for unsorted data: insert iteratively
 	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
+	//! Sink for sorted data: collect the keys of the current sorted run
 	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
+	//! Build an ART from the keys of the current sorted run, and add it to the local index
+	void BuildSortedRun(LocalSinkState &local_state) const;
+	//! Add the global index to the catalog and the table storage
+	void AddIndexToStorage(ClientContext &context, unique_ptr<BoundIndex> global_index) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkNextBatchType NextBatch(ExecutionContext &context, OperatorSinkNextBatchInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
@@ -70,5 +75,9 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+	bool RequiresBatchIndex() const override {
+		// each batch of the sorted input is a sorted run of keys
+		return sorted;
+	}
 };
 } // namespace duckdb
@@ -20,6 +20,7 @@
 namespace duckdb {
 class ClientContext;
 class ColumnDataCollection;
+class PhysicalHashJoin;
 
 //! The physical plan generator generates a physical execution plan from a
 //! logical query plan
@@ -34,6 +35,9 @@ public:
 	unordered_map<idx_t, shared_ptr<ColumnDataCollection>> recursive_cte_tables;
 	//! Materialized CTE ids must be collected.
 	unordered_map<idx_t, vector<const_reference<PhysicalOperator>>> materialized_ctes;
+	//! Whether or not the generated plan depends on the current contents of the tables (e.g. on their statistics), in
+	//! which case a prepared statement has to be re-planned before every execution
+	bool require_rebind = false;
 
 public:
 	//! Creates a plan from the logical operator. This involves resolving column bindings and generating physical
@@ -97,6 +101,8 @@ protected:
 	unique_ptr<PhysicalOperator> PlanAsOfJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanComparisonJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanDelimJoin(LogicalComparisonJoin &op);
+	//! Sets up the runtime filters that the hash join pushes into the table scan on its probe side (if possible)
+	void PlanJoinFilterPushdown(PhysicalHashJoin &join);
 	unique_ptr<PhysicalOperator> ExtractAggregateExpressions(unique_ptr<PhysicalOperator> child,
 	                                                         vector<unique_ptr<Expression>> &expressions,
 	                                                         vector<unique_ptr<Expression>> &groups);
@@ -149,6 +149,10 @@ public:
 
 	virtual void Finalize() {
 	}
+	//! Lets another thread take part in a running Finalize, returns false if there is nothing to do
+	virtual bool HelpFinalize() {
+		return false;
+	}
 
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
@@ -178,6 +182,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsSlidingAggregate(idx_t &frame_width);
 
 	WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
@@ -185,6 +190,7 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	bool HelpFinalize() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
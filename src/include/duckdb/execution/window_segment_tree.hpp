@@ -56,6 +56,10 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! Lets another thread take part in a running Finalize, returns false if there is nothing to do
+	virtual bool HelpFinalize() {
+		return false;
+	}
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -152,6 +156,8 @@ public:
 	unique_ptr<WindowAggregatorState> gstate;
 };
 
+class WindowSegmentTreePart;
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
@@ -160,6 +166,7 @@ public:
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
+	bool HelpFinalize() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -167,6 +174,8 @@ public:
 
 public:
 	void ConstructTree();
+	//! Builds the next range of nodes of the tree, returns false if there is none (yet)
+	bool TryConstructTree(WindowSegmentTreePart &part);
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -186,6 +195,42 @@ public:
 
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of nodes of a level that are built by a single construction task
+	static constexpr idx_t TREE_BUILD_NODES = 2048;
+
+private:
+	//! Serialises claiming the construction tasks
+	mutex build_lock;
+	//! Whether the tree is being built (i.e., other threads can help)
+	atomic<bool> building;
+	//! The level that is being built
+	atomic<idx_t> build_level;
+	//! The next construction task of the level that is being built
+	idx_t build_next;
+	//! The number of finished construction tasks of the level that is being built
+	idx_t build_finished;
+	//! The states of the threads that helped building the tree (their allocators own the memory of the nodes)
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+};
+
+//! Aggregates fixed-size sliding frames (e.g., ROWS BETWEEN n PRECEDING AND CURRENT ROW) without a segment tree.
+//! The rows are split into blocks of the frame width, so every frame consists of a suffix of one block and a prefix
+//! of the next block. Computing these prefix and suffix states takes a constant number of updates per row, after which
+//! every frame is a single combine.
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type, idx_t frame_width, idx_t count);
+	~WindowSlidingAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! The maximum number of rows in a frame
+	const idx_t frame_width;
+
+	//! Wider frames are aggregated using a segment tree
+	static constexpr idx_t MAXIMUM_FRAME_WIDTH = 128;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
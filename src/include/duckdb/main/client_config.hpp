@@ -81,12 +81,18 @@ struct ClientConfig {
 	bool force_fetch_row = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Use an index join for equi-joins on an indexed column, regardless of the cardinalities
+	bool force_index_join = false;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
+	//! An index scan is used if it returns at most index_scan_max_count rows, or at most index_scan_percentage of the
+	//! rows of the table
+	idx_t index_scan_max_count = STANDARD_VECTOR_SIZE;
+	double index_scan_percentage = 0.001;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
 	//! The number of rows to accumulate before flushing during a partitioned write
@@ -148,10 +148,14 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! The number of background threads that are pinned to each NUMA node. Default: 0 (no pinning).
+	idx_t threads_per_numa_node = 0;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks that are written to the temporary directory
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -23,6 +23,7 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct WorkerQueue;
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -31,10 +32,17 @@ struct ProducerToken {
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! Identifies the tasks of this producer in the local queues of the background threads, ids are never reused
+	const idx_t producer_id;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
+//! Every background thread has a local task queue: tasks that are scheduled from a background thread are pushed onto
+//! its local queue, tasks scheduled from any other thread are pushed onto the shared queue. Threads that run out of
+//! tasks steal tasks from the other threads, preferring threads that belong to the same NUMA node.
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
@@ -62,6 +70,8 @@ public:
 	//! and the number of external threads. External threads, e.g. the main thread, will also be used for execution.
 	//! Launches `total_threads - external_threads` background worker threads.
 	void SetThreads(idx_t total_threads, idx_t external_threads);
+	//! Sets the number of background threads that are assigned (and pinned) to each NUMA node, or 0 to disable
+	void SetThreadsPerNUMANode(idx_t threads_per_numa_node);
 
 	void RelaunchThreads();
 
@@ -79,6 +89,18 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Fetches a task for the background thread with the given index (from its local queue, the shared queue, or by
+	//! stealing from other threads)
+	bool GetTaskForWorker(WorkerQueue &local_queue, idx_t worker_index, shared_ptr<Task> &task);
+	//! Steals a task from the local queues of the background threads (for threads that are not background threads)
+	bool StealTask(shared_ptr<Task> &task);
+	//! Removes the tasks of a producer that is destroyed from the local queues of the background threads
+	void RemoveProducerTasks(ProducerToken &producer);
+
+	//! Runs the task loop of the background thread with the given index
+	void ExecuteForeverOnWorker(atomic<bool> *marker, WorkerQueue *local_queue, idx_t worker_index);
+	static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, WorkerQueue *local_queue,
+	                               idx_t worker_index);
 
 private:
 	DatabaseInstance &db;
@@ -90,6 +112,14 @@ private:
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! The local task queues of the background threads
+	vector<unique_ptr<WorkerQueue>> worker_queues;
+	//! Lock for accessing the local queues of other threads, and for adding or removing local queues
+	mutex worker_queue_lock;
+	//! Requested number of threads per NUMA node (set by the 'threads_per_numa_node' setting, 0 = disabled)
+	atomic<idx_t> requested_threads_per_numa_node;
+	//! The number of threads per NUMA node the background threads were launched with
+	idx_t threads_per_numa_node;
 	//! The threshold after which to flush the allocator after completing a task
 	atomic<idx_t> allocator_flush_threshold;
 	//! Requested thread count (set by the 'threads' setting)
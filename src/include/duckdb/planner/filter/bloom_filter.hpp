@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! BloomFilter is a blocked Bloom filter over the hashes of a set of keys. Every key sets a few bits within a single
+//! 64-bit word, so that a lookup only touches one word. Bloom filters are only created at runtime (e.g. by a hash join
+//! on its build side) and are never serialized.
+//! Bloom filters are adaptive: a filter that removes (almost) no tuples after it has seen a sample of the input
+//! disables itself, as hashing the input would then only slow down the scan.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The number of bits we reserve for each key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! The number of tuples after which we decide whether or not the filter is selective enough
+	static constexpr const idx_t ADAPTIVE_SAMPLE_SIZE = 65536;
+	//! The filter is disabled if it lets through more than this fraction of the tuples
+	static constexpr const double MAX_PASS_RATIO = 0.9;
+
+public:
+	//! Creates an empty Bloom filter that is sized for "key_count" keys
+	explicit BloomFilter(idx_t key_count);
+
+public:
+	//! Inserts "count" hashes into the filter (with atomic operations if "parallel" is set)
+	void Insert(const hash_t hashes[], idx_t count, bool parallel);
+	//! Returns false if the key with the given hash is definitely not in the filter
+	inline bool MayContain(hash_t hash) const {
+		auto mask = GetMask(hash);
+		return (data->words[GetWordIndex(hash)] & mask) == mask;
+	}
+	//! Removes the tuples in "sel" that are NULL or definitely not in the filter from the selection
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	idx_t KeyCount() const {
+		return key_count;
+	}
+	//! Whether or not the filter disabled itself because it was not selective enough
+	bool IsDisabled() const {
+		return data->disabled;
+	}
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	void Serialize(Serializer &serializer) const override;
+
+private:
+	//! The state of a Bloom filter, which is shared between copies as the filter is immutable once it has been built
+	struct BloomFilterData {
+		explicit BloomFilterData(idx_t word_count);
+
+		//! The bits of the filter
+		vector<uint64_t> words;
+		//! The number of tuples that have been probed and that have passed the filter
+		atomic<idx_t> probed_count;
+		atomic<idx_t> passed_count;
+		//! Whether or not the filter has been disabled
+		atomic<bool> disabled;
+	};
+
+	BloomFilter(idx_t key_count, shared_ptr<BloomFilterData> data);
+
+	inline idx_t GetWordIndex(hash_t hash) const {
+		return (hash >> 32) & word_mask;
+	}
+	static inline uint64_t GetMask(hash_t hash) {
+		return (1ULL << (hash & 63)) | (1ULL << ((hash >> 6) & 63)) | (1ULL << ((hash >> 12) & 63));
+	}
+
+private:
+	//! The number of keys the filter was sized for
+	idx_t key_count;
+	//! Mask to obtain a word index from a hash (the number of words is a power of two)
+	idx_t word_mask;
+	//! The shared state of the filter
+	shared_ptr<BloomFilterData> data;
+};
+
+} // namespace duckdb
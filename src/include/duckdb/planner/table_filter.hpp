@@ -9,12 +9,16 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
@@ -22,7 +26,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6 // probabilistic membership filter, only created at runtime (e.g. by a hash join)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -42,6 +47,7 @@ public:
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 
 	virtual void Serialize(Serializer &serializer) const;
 	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
@@ -100,4 +106,23 @@ public:
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet contains filters that are pushed into a table scan at runtime by other operators
+//! (e.g. the min/max and Bloom filters of a hash join build side). Filters are grouped by the operator that pushed
+//! them, so that an operator can replace its filters when it is executed again.
+class DynamicTableFilterSet {
+public:
+	//! Removes all filters that were pushed by the given operator
+	void ClearFilters(const PhysicalOperator &op);
+	//! Pushes a filter on the column with the given index (into the column_ids of the scan)
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+
+	bool HasFilters() const;
+	//! Combines the static filters of the scan with the dynamic filters that have been pushed so far
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
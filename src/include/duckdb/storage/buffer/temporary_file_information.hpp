@@ -14,6 +14,8 @@ struct MemoryInformation {
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The ratio between the size of the (uncompressed) blocks and the size they occupy in the file
+	double compression_ratio = 1.0;
 };
 
 } // namespace duckdb
@@ -180,6 +180,8 @@ public:
 
 	//! Get statistics of a physical column within the table
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
+	//! Get the statistics of a physical column for every row group of the table, in storage order
+	vector<unique_ptr<BaseStatistics>> GetRowGroupStatistics(column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
 
@@ -133,6 +133,10 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	//! Returns the compression types of the columns when writing this row group with the given writer
+	vector<CompressionType> GetCompressionTypes(RowGroupWriter &writer);
+	//! Checkpoint a single column of the row group. Different columns of a row group can be written in parallel
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 
 	void InitializeAppend(RowGroupAppendState &append_state);
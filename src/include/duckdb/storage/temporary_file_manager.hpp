@@ -12,6 +12,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
@@ -27,7 +28,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -45,6 +46,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size on disk of a single block (used to account for the size of the temporary files)
+	idx_t block_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -75,7 +78,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -89,10 +92,20 @@ public:
 public:
 	TemporaryFileIndex TryGetBlockIndex();
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a compressed block (of exactly "slot_size" bytes) to the file
+	void WriteTemporaryFile(data_ptr_t compressed_data, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	//! The size of the slots in this file
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
+	//! Whether or not the blocks in this file are compressed
+	bool IsCompressed() const {
+		return slot_size < Storage::BLOCK_ALLOC_SIZE;
+	}
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -101,12 +114,18 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	//! The size of a single slot in the file (Storage::BLOCK_ALLOC_SIZE for uncompressed blocks)
+	const idx_t slot_size;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+	//! The compressed size of each block in this file (only for compressed files)
+	unordered_map<idx_t, idx_t> compressed_sizes;
+	//! The sum of the compressed sizes of the blocks in this file
+	idx_t total_compressed_size = 0;
 };
 
 //===--------------------------------------------------------------------===//
@@ -132,6 +151,12 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed blocks are stored in slots that are a multiple of this size
+	static constexpr const idx_t COMPRESSED_SLOT_SIZE = Storage::BLOCK_ALLOC_SIZE / 8;
+	//! The ZSTD compression level used for compressing temporary blocks
+	static constexpr const int COMPRESSION_LEVEL = 1;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -162,6 +187,8 @@ private:
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
+	//! Tries to compress the buffer, returns the slot size of the compressed block (or BLOCK_ALLOC_SIZE on failure)
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
 
@@ -16,6 +16,7 @@
 namespace duckdb {
 
 class ClientContext;
+class DatabaseInstance;
 class TemporaryMemoryManager;
 
 //! State of the temporary memory to be managed concurrently with other states
@@ -32,6 +33,8 @@ public:
 public:
 	//! Set the remaining size needed for this state, and updates the reservation
 	void SetRemainingSize(ClientContext &context, idx_t new_remaining_size);
+	//! Set the remaining size needed for this state, and updates the reservation (outside of a query)
+	void SetRemainingSize(DatabaseInstance &db, idx_t new_remaining_size);
 	//! Get the remaining size that was set for this state
 	idx_t GetRemainingSize() const;
 	//! Set the minimum reservation for this state
@@ -78,14 +81,16 @@ public:
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Register a TemporaryMemoryState outside of a query, e.g., during a checkpoint
+	unique_ptr<TemporaryMemoryState> Register(DatabaseInstance &db);
 
 private:
 	//! Locks the TemporaryMemoryManager
 	unique_lock<mutex> Lock();
 	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
-	void UpdateConfiguration(ClientContext &context);
+	void UpdateConfiguration(DatabaseInstance &db);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
-	void UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state);
+	void UpdateState(DatabaseInstance &db, bool force_external, TemporaryMemoryState &temporary_memory_state);
 	//! Set the remaining size of a TemporaryMemoryState (must hold the lock)
 	void SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size);
 	//! Set the reservation of a TemporaryMemoryState (must hold the lock)
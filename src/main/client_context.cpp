@@ -359,6 +359,9 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	PhysicalPlanGenerator physical_planner(*this);
 	auto physical_plan = physical_planner.CreatePlan(std::move(plan));
 	profiler.EndPhase();
+	if (physical_planner.require_rebind) {
+		result->properties.always_require_rebind = true;
+	}
 
 #ifdef DEBUG
 	D_ASSERT(!physical_plan->ToString().empty());
@@ -64,6 +64,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(DebugForceNoCrossProduct),
     DUCKDB_LOCAL(DebugAsOfIEJoin),
     DUCKDB_LOCAL(PreferRangeJoins),
+    DUCKDB_LOCAL(ForceIndexJoin),
     DUCKDB_GLOBAL(DebugWindowMode),
     DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
     DUCKDB_GLOBAL(DefaultOrderSetting),
@@ -97,6 +98,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(EnableViewDependencies),
     DUCKDB_GLOBAL(LockConfigurationSetting),
     DUCKDB_GLOBAL(ImmediateTransactionModeSetting),
+    DUCKDB_LOCAL(IndexScanMaxCountSetting),
+    DUCKDB_LOCAL(IndexScanPercentageSetting),
     DUCKDB_LOCAL(IntegerDivisionSetting),
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_GLOBAL(MaximumMemorySetting),
@@ -120,7 +123,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
+    DUCKDB_GLOBAL(ThreadsPerNUMANodeSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
@@ -238,6 +238,21 @@ Value PreferRangeJoins::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Force Index Join
+//===--------------------------------------------------------------------===//
+void ForceIndexJoin::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).force_index_join = ClientConfig().force_index_join;
+}
+
+void ForceIndexJoin::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).force_index_join = input.GetValue<bool>();
+}
+
+Value ForceIndexJoin::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_index_join);
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
@@ -944,6 +959,40 @@ Value HomeDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(config.home_directory);
 }
 
+//===--------------------------------------------------------------------===//
+// Index Scan Max Count
+//===--------------------------------------------------------------------===//
+void IndexScanMaxCountSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).index_scan_max_count = ClientConfig().index_scan_max_count;
+}
+
+void IndexScanMaxCountSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).index_scan_max_count = input.GetValue<uint64_t>();
+}
+
+Value IndexScanMaxCountSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).index_scan_max_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Scan Percentage
+//===--------------------------------------------------------------------===//
+void IndexScanPercentageSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).index_scan_percentage = ClientConfig().index_scan_percentage;
+}
+
+void IndexScanPercentageSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto percentage = input.GetValue<double>();
+	if (percentage < 0 || percentage > 1) {
+		throw InvalidInputException("the index scan percentage must be within the range 0 - 1");
+	}
+	ClientConfig::GetConfig(context).index_scan_percentage = percentage;
+}
+
+Value IndexScanPercentageSetting::GetSetting(const ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).index_scan_percentage);
+}
+
 //===--------------------------------------------------------------------===//
 // Integer Division
 //===--------------------------------------------------------------------===//
@@ -1401,6 +1450,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1429,6 +1494,30 @@ Value ThreadsSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(config.options.maximum_threads));
 }
 
+//===--------------------------------------------------------------------===//
+// Threads Per NUMA Node Setting
+//===--------------------------------------------------------------------===//
+void ThreadsPerNUMANodeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto new_val = input.GetValue<uint64_t>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadsPerNUMANode(new_val);
+	}
+	config.options.threads_per_numa_node = new_val;
+}
+
+void ThreadsPerNUMANodeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	idx_t new_val = DBConfig().options.threads_per_numa_node;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadsPerNUMANode(new_val);
+	}
+	config.options.threads_per_numa_node = new_val;
+}
+
+Value ThreadsPerNUMANodeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.threads_per_numa_node);
+}
+
 //===--------------------------------------------------------------------===//
 // Username Setting
 //===--------------------------------------------------------------------===//
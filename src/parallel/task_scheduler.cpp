@@ -8,10 +8,15 @@
 
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/fstream.hpp"
 #include "duckdb/common/thread.hpp"
 #include "lightweightsemaphore.h"
 
 #include <thread>
+#if defined(__linux__)
+#include <sched.h>
+#endif
 #else
 #include <queue>
 #endif
@@ -50,6 +55,152 @@ struct QueueProducerToken {
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
+//! A task in the local queue of a background thread, together with the producer that scheduled it
+//! A producer removes its tasks from the local queues when it is destroyed, so the producer is valid while the task is
+//! in a queue
+struct LocalTask {
+	ProducerToken *producer;
+	idx_t producer_id;
+	shared_ptr<Task> task;
+};
+
+//! The local task queue of a background thread. The owning thread pushes and pops tasks at the back, other threads
+//! steal the oldest tasks from the front.
+struct WorkerQueue {
+	explicit WorkerQueue(idx_t numa_node) : numa_node(numa_node), size(0) {
+	}
+
+	//! The NUMA node the background thread belongs to
+	const idx_t numa_node;
+	mutex lock;
+	deque<LocalTask> tasks;
+	//! The number of tasks in the queue, used to skip empty queues without locking them
+	atomic<idx_t> size;
+
+	void Push(ProducerToken &producer, shared_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(LocalTask {&producer, producer.producer_id, std::move(task)});
+		size++;
+	}
+
+	bool Pop(shared_ptr<Task> &task) {
+		if (size.load() == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back().task);
+		tasks.pop_back();
+		size--;
+		return true;
+	}
+
+	bool Steal(shared_ptr<Task> &task) {
+		if (size.load() == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front().task);
+		tasks.pop_front();
+		size--;
+		return true;
+	}
+
+	bool StealFromProducer(ProducerToken &producer, shared_ptr<Task> &task) {
+		if (size.load() == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.begin(); it != tasks.end(); it++) {
+			if (it->producer_id == producer.producer_id) {
+				task = std::move(it->task);
+				tasks.erase(it);
+				size--;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void RemoveProducer(ProducerToken &producer, vector<shared_ptr<Task>> &removed_tasks) {
+		if (size.load() == 0) {
+			return;
+		}
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.begin(); it != tasks.end();) {
+			if (it->producer_id == producer.producer_id) {
+				removed_tasks.push_back(std::move(it->task));
+				it = tasks.erase(it);
+				size--;
+			} else {
+				it++;
+			}
+		}
+	}
+};
+
+//! The id of the next producer token
+static atomic<idx_t> next_producer_id {0};
+
+//! The scheduler and local queue of the current thread, if it is a background thread
+static thread_local TaskScheduler *current_scheduler = nullptr;
+static thread_local WorkerQueue *current_worker_queue = nullptr;
+
+//! Returns the CPUs of every NUMA node of the system (or an empty list if the topology cannot be determined)
+static vector<vector<idx_t>> GetNUMANodeCPUs() {
+	vector<vector<idx_t>> result;
+#if defined(__linux__)
+	for (idx_t node = 0;; node++) {
+		ifstream cpu_list_file("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+		if (!cpu_list_file.is_open()) {
+			break;
+		}
+		// the CPU list has the format "0-15,32-47"
+		string cpu_list;
+		std::getline(cpu_list_file, cpu_list);
+		vector<idx_t> cpus;
+		for (auto &range : StringUtil::Split(cpu_list, ',')) {
+			auto bounds = StringUtil::Split(range, '-');
+			if (bounds.empty() || bounds.size() > 2) {
+				return vector<vector<idx_t>>();
+			}
+			auto start = std::stoull(bounds[0]);
+			auto end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+			for (auto cpu = start; cpu <= end; cpu++) {
+				cpus.push_back(cpu);
+			}
+		}
+		result.push_back(std::move(cpus));
+	}
+#endif
+	return result;
+}
+
+//! Pins the current thread to the CPUs of the given NUMA node (if supported)
+static void PinThreadToNUMANode(idx_t numa_node) {
+#if defined(__linux__)
+	static const auto numa_node_cpus = GetNUMANodeCPUs();
+	if (numa_node_cpus.empty()) {
+		return;
+	}
+	auto &cpus = numa_node_cpus[numa_node % numa_node_cpus.size()];
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// pinning is best-effort: ignore failures
+	sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#endif
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
@@ -92,17 +243,27 @@ struct QueueProducerToken {
 	QueueProducerToken(ConcurrentQueue &queue) {
 	}
 };
+
+//! Without threads there are no background threads, and no local queues
+struct WorkerQueue {};
 #endif
 
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+    : scheduler(scheduler), token(std::move(token)),
+#ifndef DUCKDB_NO_THREADS
+      producer_id(next_producer_id++) {
+#else
+      producer_id(0) {
+#endif
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.RemoveProducerTasks(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
+      requested_threads_per_numa_node(db.config.options.threads_per_numa_node), threads_per_numa_node(0),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
       current_thread_count(1) {
 }
@@ -131,12 +292,122 @@ unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+#ifndef DUCKDB_NO_THREADS
+	if (current_scheduler == this) {
+		// scheduled from one of our background threads: push the task onto its local queue
+		current_worker_queue->Push(token, std::move(task));
+		queue->semaphore.signal();
+		return;
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(token, task)) {
+		return true;
+	}
+#ifndef DUCKDB_NO_THREADS
+	// the task might have been scheduled from a background thread: look in the local queues
+	lock_guard<mutex> guard(worker_queue_lock);
+	for (auto &worker_queue : worker_queues) {
+		if (worker_queue->StealFromProducer(token, task)) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+bool TaskScheduler::GetTaskForWorker(WorkerQueue &local_queue, idx_t worker_index, shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	// first look in the local queue of the thread
+	if (local_queue.Pop(task)) {
+		return true;
+	}
+	// then in the shared queue
+	if (queue->q.try_dequeue(task)) {
+		return true;
+	}
+	// finally try to steal a task from another thread, preferring threads on the same NUMA node
+	lock_guard<mutex> guard(worker_queue_lock);
+	auto worker_count = worker_queues.size();
+	for (idx_t same_node = 0; same_node < 2; same_node++) {
+		for (idx_t i = 1; i <= worker_count; i++) {
+			auto &victim = *worker_queues[(worker_index + i) % worker_count];
+			if (&victim == &local_queue || (victim.numa_node == local_queue.numa_node) != (same_node == 0)) {
+				continue;
+			}
+			if (victim.Steal(task)) {
+				return true;
+			}
+		}
+	}
+#endif
+	return false;
+}
+
+bool TaskScheduler::StealTask(shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> guard(worker_queue_lock);
+	for (auto &worker_queue : worker_queues) {
+		if (worker_queue->Steal(task)) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+void TaskScheduler::RemoveProducerTasks(ProducerToken &producer) {
+#ifndef DUCKDB_NO_THREADS
+	// the removed tasks are only destroyed after the lock is released, as destroying them can destroy other producers
+	vector<shared_ptr<Task>> removed_tasks;
+	lock_guard<mutex> guard(worker_queue_lock);
+	for (auto &worker_queue : worker_queues) {
+		worker_queue->RemoveProducer(producer, removed_tasks);
+	}
+#endif
+}
+
+void TaskScheduler::ExecuteForeverOnWorker(atomic<bool> *marker, WorkerQueue *local_queue, idx_t worker_index) {
+#ifndef DUCKDB_NO_THREADS
+	current_scheduler = this;
+	current_worker_queue = local_queue;
+	if (threads_per_numa_node > 0) {
+		PinThreadToNUMANode(current_worker_queue->numa_node);
+	}
+	shared_ptr<Task> task;
+	// loop until the marker is set to false
+	while (*marker) {
+		// wait for a signal with a timeout
+		queue->semaphore.wait();
+		if (GetTaskForWorker(*local_queue, worker_index, task)) {
+			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+
+			switch (execute_result) {
+			case TaskExecutionResult::TASK_FINISHED:
+			case TaskExecutionResult::TASK_ERROR:
+				task.reset();
+				break;
+			case TaskExecutionResult::TASK_NOT_FINISHED:
+				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
+			case TaskExecutionResult::TASK_BLOCKED:
+				task->Deschedule();
+				task.reset();
+				break;
+			}
+
+			// Flushes the outstanding allocator's outstanding allocations
+			Allocator::ThreadFlush(allocator_flush_threshold);
+		}
+	}
+	current_scheduler = nullptr;
+	current_worker_queue = nullptr;
+#else
+	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
+#endif
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
@@ -177,7 +448,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->q.try_dequeue(task) && !StealTask(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -207,7 +478,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->q.try_dequeue(task) && !StealTask(task)) {
 			return;
 		}
 		try {
@@ -233,11 +504,10 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #endif
 }
 
-#ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+void TaskScheduler::ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, WorkerQueue *local_queue,
+                                       idx_t worker_index) {
+	scheduler->ExecuteForeverOnWorker(marker, local_queue, worker_index);
 }
-#endif
 
 int32_t TaskScheduler::NumberOfThreads() {
 	return current_thread_count.load();
@@ -260,6 +530,10 @@ void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 	requested_thread_count = NumericCast<int32_t>(total_threads - external_threads);
 }
 
+void TaskScheduler::SetThreadsPerNUMANode(idx_t threads_per_numa_node_p) {
+	requested_threads_per_numa_node = threads_per_numa_node_p;
+}
+
 void TaskScheduler::SetAllocatorFlushTreshold(idx_t threshold) {
 }
 
@@ -286,12 +560,13 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	auto new_thread_count = NumericCast<idx_t>(n);
-	if (threads.size() == new_thread_count) {
+	auto new_threads_per_numa_node = requested_threads_per_numa_node.load();
+	if (threads.size() == new_thread_count && threads_per_numa_node == new_threads_per_numa_node) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (threads.size() > new_thread_count || threads_per_numa_node != new_threads_per_numa_node) {
+		// we are reducing the number of threads or assigning them to different NUMA nodes: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -303,19 +578,38 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		// erase the threads/markers
 		threads.clear();
 		markers.clear();
+
+		// move any tasks that are left in the local queues to the shared queue
+		lock_guard<mutex> guard(worker_queue_lock);
+		for (auto &worker_queue : worker_queues) {
+			for (auto &local_task : worker_queue->tasks) {
+				queue->Enqueue(*local_task.producer, std::move(local_task.task));
+			}
+		}
+		worker_queues.clear();
+		threads_per_numa_node = new_threads_per_numa_node;
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
-		idx_t create_new_threads = new_thread_count - threads.size();
-		for (idx_t i = 0; i < create_new_threads; i++) {
+		// the running threads keep their local queues, the new threads get new (empty) local queues
+		for (idx_t i = threads.size(); i < new_thread_count; i++) {
+			auto numa_node = threads_per_numa_node == 0 ? 0 : i / threads_per_numa_node;
+			auto worker_queue = make_uniq<WorkerQueue>(numa_node);
+			auto &local_queue = *worker_queue;
+			{
+				lock_guard<mutex> guard(worker_queue_lock);
+				worker_queues.push_back(std::move(worker_queue));
+			}
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), &local_queue, i);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
+				lock_guard<mutex> guard(worker_queue_lock);
+				worker_queues.pop_back();
 				break;
 			}
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
@@ -0,0 +1,105 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilterData::BloomFilterData(idx_t word_count)
+    : words(word_count, uint64_t(0)), probed_count(0), passed_count(0), disabled(false) {
+}
+
+BloomFilter::BloomFilter(idx_t key_count_p) : TableFilter(TableFilterType::BLOOM_FILTER), key_count(key_count_p) {
+	auto word_count = NextPowerOfTwo(MaxValue<idx_t>(key_count * BITS_PER_KEY / 64, 1));
+	word_mask = word_count - 1;
+	data = make_shared_ptr<BloomFilterData>(word_count);
+}
+
+BloomFilter::BloomFilter(idx_t key_count_p, shared_ptr<BloomFilterData> data_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), key_count(key_count_p), word_mask(data_p->words.size() - 1),
+      data(std::move(data_p)) {
+}
+
+void BloomFilter::Insert(const hash_t hashes[], idx_t count, bool parallel) {
+	auto word_data = data->words.data();
+	if (parallel) {
+		auto atomic_data = reinterpret_cast<atomic<uint64_t> *>(word_data);
+		for (idx_t i = 0; i < count; i++) {
+			atomic_data[GetWordIndex(hashes[i])].fetch_or(GetMask(hashes[i]), std::memory_order_relaxed);
+		}
+	} else {
+		for (idx_t i = 0; i < count; i++) {
+			word_data[GetWordIndex(hashes[i])] |= GetMask(hashes[i]);
+		}
+	}
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	if (data->disabled) {
+		// the filter is not selective: the join removes the remaining tuples (including NULL values)
+		return approved_tuple_count;
+	}
+	// hash the tuples that are still selected
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(STANDARD_VECTOR_SIZE, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	// NULL values can never be equal to a key, so they are filtered out as well
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			continue;
+		}
+		if (MayContain(hash_data[hdata.sel->get_index(idx)])) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	// keep track of the selectivity of the filter, and disable it if it does not remove enough tuples
+	auto probed_count = data->probed_count.fetch_add(approved_tuple_count) + approved_tuple_count;
+	auto passed_count = data->passed_count.fetch_add(result_count) + result_count;
+	if (probed_count >= ADAPTIVE_SAMPLE_SIZE &&
+	    static_cast<double>(passed_count) > static_cast<double>(probed_count) * MAX_PASS_RATIO) {
+		data->disabled = true;
+	}
+
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// a Bloom filter does not say anything about min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(key_count) + " keys)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.data == data;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return unique_ptr<TableFilter>(new BloomFilter(key_count, data));
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	throw SerializationException("Bloom filters are created at runtime and cannot be serialized");
+}
+
+} // namespace duckdb
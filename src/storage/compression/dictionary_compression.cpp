@@ -429,6 +429,7 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
@@ -451,6 +452,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -470,7 +472,13 @@ template <bool ALLOW_DICT_VECTORS>
 void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
                                                      Vector &result, idx_t result_offset) {
 	// clear any previously locked buffers and get the primary buffer handle
+	if (!state.scan_state || !dynamic_cast<CompressedStringScanState *>(state.scan_state.get())) {
+		fprintf(stderr, "DBG bad scan state %p seg=%p start=%llu count=%llu row=%llu func=%d\n", (void *)state.scan_state.get(), (void *)&segment, (unsigned long long)segment.start, (unsigned long long)segment.count.load(), (unsigned long long)state.row_index, int(segment.function.get().type));
+		if (state.scan_state) fprintf(stderr, "DBG type %s\n", typeid(*state.scan_state).name());
+		abort();
+	}
 	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	if (!scan_state.handle.IsValid()) { fprintf(stderr, "DBG invalid handle\n"); abort(); }
 	auto start = segment.GetRelativeIndex(state.row_index);
 
 	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
@@ -533,7 +541,7 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 
 		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		result.Dictionary(*(scan_state.dictionary), scan_state.dictionary_size, *scan_state.sel_vec, scan_count);
 	}
 }
 
@@ -0,0 +1,549 @@
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, a number of compressed frames, and a directory with an entry for every frame:
+// | header | frame 0 | frame 1 | ... | frame n | directory |
+// A frame holds a run of consecutive strings: the lengths of the strings (uint32_t) followed by the string data,
+// compressed as a single ZSTD frame. Scans and fetches only decompress the frames that hold the requested rows.
+typedef struct {
+	uint32_t frame_count;
+	uint32_t directory_offset;
+} zstd_compression_header_t;
+
+typedef struct {
+	//! The first row of the frame (relative to the start of the segment)
+	uint32_t row_start;
+	//! The offset of the compressed frame within the segment
+	uint32_t offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_entry_t;
+
+struct ZSTDStorage {
+	static constexpr size_t COMPACTION_FLUSH_LIMIT = (size_t)Storage::BLOCK_SIZE / 5 * 4;
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! Strings that do not fit in a string block are left to the overflow blocks of the uncompressed storage
+	static constexpr idx_t MAX_STRING_SIZE = StringUncompressed::STRING_BLOCK_LIMIT;
+	//! A frame is compressed once it holds this amount of string data, or MAX_FRAME_COUNT strings
+	static constexpr idx_t TARGET_FRAME_SIZE = Storage::BLOCK_SIZE / 4;
+	static constexpr idx_t MAX_FRAME_COUNT = MinValue<idx_t>(2048, Storage::BLOCK_SIZE / 8 / sizeof(uint32_t));
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	//! The cost of decompressing a byte of string data, relative to the cost of storing (and reading) a byte: ZSTD
+	//! decompresses a lot slower than the lightweight string compression methods decode
+	static constexpr double DECOMPRESSION_COST = 0.1;
+	//! The (byte-equivalent) cost of locating a string in its decompressed frame
+	static constexpr idx_t DECOMPRESSION_COST_PER_STRING = 8;
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	static idx_t GetFrameCount(data_ptr_t base_ptr);
+	static zstd_frame_entry_t GetFrameEntry(data_ptr_t base_ptr, idx_t frame_idx);
+	static idx_t GetFrameEnd(ColumnSegment &segment, data_ptr_t base_ptr, idx_t frame_idx);
+	static idx_t FindFrame(data_ptr_t base_ptr, idx_t row);
+	static void DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t base_ptr, const zstd_frame_entry_t &entry,
+	                            data_ptr_t target);
+};
+
+//===--------------------------------------------------------------------===//
+// Frame Builder
+//===--------------------------------------------------------------------===//
+//! Collects the strings of a frame, and compresses them
+struct ZSTDFrameBuilder {
+	vector<uint32_t> lengths;
+	vector<data_t> string_data;
+
+	idx_t Count() const {
+		return lengths.size();
+	}
+	idx_t SizeInBytes() const {
+		return lengths.size() * sizeof(uint32_t) + string_data.size();
+	}
+	bool IsFull(idx_t string_size) const {
+		if (lengths.empty()) {
+			return false;
+		}
+		return lengths.size() >= ZSTDStorage::MAX_FRAME_COUNT ||
+		       string_data.size() + string_size > ZSTDStorage::TARGET_FRAME_SIZE;
+	}
+	void Append(const string_t &str) {
+		auto size = str.GetSize();
+		lengths.push_back(UnsafeNumericCast<uint32_t>(size));
+		auto data = const_data_ptr_cast(str.GetData());
+		string_data.insert(string_data.end(), data, data + size);
+	}
+	void Reset() {
+		lengths.clear();
+		string_data.clear();
+	}
+	//! Compresses the frame into "target", and returns the compressed size
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, vector<data_t> &target) {
+		auto lengths_size = lengths.size() * sizeof(uint32_t);
+		source.resize(SizeInBytes());
+		memcpy(source.data(), lengths.data(), lengths_size);
+		if (!string_data.empty()) {
+			memcpy(source.data() + lengths_size, string_data.data(), string_data.size());
+		}
+		target.resize(duckdb_zstd::ZSTD_compressBound(source.size()));
+		auto res = duckdb_zstd::ZSTD_compressCCtx(context, target.data(), target.size(), source.data(), source.size(),
+		                                          ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(res)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(res));
+		}
+		return res;
+	}
+
+private:
+	vector<data_t> source;
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState() : count(0), total_size(0), sampled_size(0), sampled_compressed_size(0) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+	}
+
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CompressFrame() {
+		sampled_size += frame.SizeInBytes();
+		sampled_compressed_size += frame.Compress(context, compressed_buffer);
+		frame.Reset();
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	idx_t count;
+	idx_t total_size;
+
+	ZSTDFrameBuilder frame;
+	vector<data_t> compressed_buffer;
+	idx_t sampled_size;
+	idx_t sampled_compressed_size;
+
+	RandomEngine random_engine;
+	bool have_sample = false;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<ZSTDAnalyzeState>();
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// we compress a sample of the vectors to estimate the compression ratio (but always the first one)
+	bool sample_selected = !state.have_sample || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	state.have_sample = true;
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		// NULL values are stored as empty strings
+		auto str = vdata.validity.RowIsValid(idx) ? data[idx] : string_t(nullptr, 0);
+
+		// We need to check all strings for this, otherwise we run in to trouble during compression if we miss ones
+		auto string_size = str.GetSize();
+		if (string_size >= MAX_STRING_SIZE) {
+			return false;
+		}
+		state.total_size += string_size;
+
+		if (!sample_selected) {
+			continue;
+		}
+		if (state.frame.IsFull(string_size)) {
+			state.CompressFrame();
+		}
+		state.frame.Append(str);
+	}
+	state.count += count;
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.count == 0 || state.total_size == 0) {
+		// there is no string data to compress (e.g. only NULL values)
+		return DConstants::INVALID_INDEX;
+	}
+	if (state.frame.Count() > 0) {
+		state.CompressFrame();
+	}
+	D_ASSERT(state.sampled_size > 0);
+	auto compression_ratio = double(state.sampled_compressed_size) / double(state.sampled_size);
+
+	auto uncompressed_size = state.total_size + state.count * sizeof(uint32_t);
+	auto frame_count = MaxValue<idx_t>(state.count / MAX_FRAME_COUNT, state.total_size / TARGET_FRAME_SIZE) + 1;
+	auto estimated_base_size = double(uncompressed_size) * compression_ratio;
+	auto segment_count = idx_t(estimated_base_size) / Storage::BLOCK_SIZE + 1;
+	auto estimated_size = estimated_base_size + double(frame_count * sizeof(zstd_frame_entry_t)) +
+	                      double(segment_count * sizeof(zstd_compression_header_t));
+
+	// every scan has to decompress all of the frames again
+	auto decompression_cost =
+	    double(uncompressed_size) * DECOMPRESSION_COST + double(state.count * DECOMPRESSION_COST_PER_STRING);
+	return NumericCast<idx_t>(estimated_size + decompression_cost);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	explicit ZSTDCompressionState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame_stats(StringStats::CreateEmpty(checkpointer.GetType())) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment = std::move(compressed_segment);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		current_offset = sizeof(zstd_compression_header_t);
+		directory.clear();
+	}
+
+	void Append(const string_t &str, bool is_valid) {
+		if (frame.IsFull(str.GetSize())) {
+			FlushFrame();
+		}
+		frame.Append(str);
+		if (is_valid) {
+			StringStats::Update(frame_stats, str);
+		}
+	}
+
+	idx_t GetRequiredSize(idx_t compressed_size) {
+		return current_offset + compressed_size + (directory.size() + 1) * sizeof(zstd_frame_entry_t);
+	}
+
+	void FlushFrame() {
+		D_ASSERT(frame.Count() > 0);
+		auto compressed_size = frame.Compress(context, compressed_buffer);
+		if (GetRequiredSize(compressed_size) > Storage::BLOCK_SIZE) {
+			Flush();
+			if (GetRequiredSize(compressed_size) > Storage::BLOCK_SIZE) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+
+		zstd_frame_entry_t entry;
+		entry.row_start = UnsafeNumericCast<uint32_t>(current_segment->count.load());
+		entry.offset = UnsafeNumericCast<uint32_t>(current_offset);
+		entry.compressed_size = UnsafeNumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = UnsafeNumericCast<uint32_t>(frame.SizeInBytes());
+		directory.push_back(entry);
+
+		memcpy(current_handle.Ptr() + current_offset, compressed_buffer.data(), compressed_size);
+		current_offset += compressed_size;
+
+		// the frame has been written to the current segment: update its count and statistics
+		current_segment->count += frame.Count();
+		current_segment->stats.statistics.Merge(frame_stats);
+		frame_stats = StringStats::CreateEmpty(checkpointer.GetType());
+		frame.Reset();
+	}
+
+	void Flush(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		auto segment_size = Finalize();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	idx_t Finalize() {
+		auto base_ptr = current_handle.Ptr();
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(directory.size()), data_ptr_cast(&header_ptr->frame_count));
+		Store<uint32_t>(NumericCast<uint32_t>(current_offset), data_ptr_cast(&header_ptr->directory_offset));
+
+		// the directory directly follows the frames
+		auto directory_size = directory.size() * sizeof(zstd_frame_entry_t);
+		memcpy(base_ptr + current_offset, directory.data(), directory_size);
+
+		auto total_size = current_offset + directory_size;
+		D_ASSERT(total_size <= Storage::BLOCK_SIZE);
+		if (total_size >= ZSTDStorage::COMPACTION_FLUSH_LIMIT) {
+			// the block is full enough, don't bother reporting the exact size
+			return Storage::BLOCK_SIZE;
+		}
+		return total_size;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	duckdb_zstd::ZSTD_CCtx *context;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	idx_t current_offset;
+	vector<zstd_frame_entry_t> directory;
+
+	// State regarding the current frame
+	ZSTDFrameBuilder frame;
+	BaseStatistics frame_stats;
+	vector<data_t> compressed_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.Append(string_t(nullptr, 0), false);
+		} else {
+			state.Append(data[idx], true);
+		}
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	if (state.frame.Count() > 0) {
+		state.FlushFrame();
+	}
+	state.Flush(true);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	ZSTDScanState() : frame_idx(DConstants::INVALID_INDEX), frame_start(0), frame_end(0) {
+		context = duckdb_zstd::ZSTD_createDCtx();
+	}
+
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+	idx_t frame_count;
+
+	//! The currently decompressed frame, and the rows it holds
+	idx_t frame_idx;
+	idx_t frame_start;
+	idx_t frame_end;
+	buffer_ptr<VectorBuffer> frame_buffer;
+	//! The offsets of the strings within the decompressed frame
+	vector<uint32_t> string_offsets;
+
+	void LoadFrame(ColumnSegment &segment, idx_t new_frame_idx) {
+		auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		auto entry = ZSTDStorage::GetFrameEntry(base_ptr, new_frame_idx);
+		frame_idx = new_frame_idx;
+		frame_start = entry.row_start;
+		frame_end = ZSTDStorage::GetFrameEnd(segment, base_ptr, new_frame_idx);
+
+		// decompress into a new buffer: vectors we have emitted before may still reference the previous one
+		frame_buffer = make_buffer<VectorBuffer>(entry.uncompressed_size);
+		auto frame_data = frame_buffer->GetData();
+		ZSTDStorage::DecompressFrame(context, base_ptr, entry, frame_data);
+
+		auto count = frame_end - frame_start;
+		string_offsets.resize(count);
+		auto offset = UnsafeNumericCast<uint32_t>(count * sizeof(uint32_t));
+		for (idx_t i = 0; i < count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(frame_data + i * sizeof(uint32_t));
+		}
+		D_ASSERT(offset == entry.uncompressed_size);
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	state->frame_count = GetFrameCount(state->handle.Ptr() + segment.GetBlockOffset());
+	return std::move(state);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		if (row < scan_state.frame_start || row >= scan_state.frame_end) {
+			// we need a different frame: usually this is the next one
+			auto next_frame = scan_state.frame_idx + 1;
+			bool is_next_frame = scan_state.frame_idx != DConstants::INVALID_INDEX &&
+			                     next_frame < scan_state.frame_count && row == scan_state.frame_end;
+			auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+			scan_state.LoadFrame(segment, is_next_frame ? next_frame : FindFrame(base_ptr, row));
+		}
+		auto frame_data = scan_state.frame_buffer->GetData();
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, scan_state.frame_end - row);
+		auto frame_row = row - scan_state.frame_start;
+		for (idx_t i = 0; i < to_scan; i++) {
+			auto length = Load<uint32_t>(frame_data + (frame_row + i) * sizeof(uint32_t));
+			auto str_ptr = char_ptr_cast(frame_data + scan_state.string_offsets[frame_row + i]);
+			result_data[result_offset + scanned + i] = string_t(str_ptr, length);
+		}
+		// the strings point into the decompressed frame: keep it alive for as long as the vector references it
+		StringVector::AddBuffer(result, scan_state.frame_buffer);
+		scanned += to_scan;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	// only decompress the frame that holds the row
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto frame_idx = FindFrame(base_ptr, row);
+	auto entry = GetFrameEntry(base_ptr, frame_idx);
+	auto frame_data = make_unsafe_uniq_array<data_t>(entry.uncompressed_size);
+	DecompressFrame(nullptr, base_ptr, entry, frame_data.get());
+
+	auto count = GetFrameEnd(segment, base_ptr, frame_idx) - entry.row_start;
+	auto frame_row = row - entry.row_start;
+	idx_t offset = count * sizeof(uint32_t);
+	for (idx_t i = 0; i < frame_row; i++) {
+		offset += Load<uint32_t>(frame_data.get() + i * sizeof(uint32_t));
+	}
+	auto length = Load<uint32_t>(frame_data.get() + frame_row * sizeof(uint32_t));
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] =
+	    StringVector::AddStringOrBlob(result, string_t(char_ptr_cast(frame_data.get() + offset), length));
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(PhysicalType type) {
+	return type == PhysicalType::VARCHAR;
+}
+
+//===--------------------------------------------------------------------===//
+// Helper Functions
+//===--------------------------------------------------------------------===//
+idx_t ZSTDStorage::GetFrameCount(data_ptr_t base_ptr) {
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	return Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+}
+
+zstd_frame_entry_t ZSTDStorage::GetFrameEntry(data_ptr_t base_ptr, idx_t frame_idx) {
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	auto directory_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->directory_offset));
+	D_ASSERT(frame_idx < GetFrameCount(base_ptr));
+	return Load<zstd_frame_entry_t>(base_ptr + directory_offset + frame_idx * sizeof(zstd_frame_entry_t));
+}
+
+idx_t ZSTDStorage::GetFrameEnd(ColumnSegment &segment, data_ptr_t base_ptr, idx_t frame_idx) {
+	if (frame_idx + 1 < GetFrameCount(base_ptr)) {
+		return GetFrameEntry(base_ptr, frame_idx + 1).row_start;
+	}
+	return segment.count;
+}
+
+// Returns the index of the frame that holds the given row
+idx_t ZSTDStorage::FindFrame(data_ptr_t base_ptr, idx_t row) {
+	// binary search for the last frame that starts at or before the row
+	idx_t lower = 0;
+	idx_t upper = GetFrameCount(base_ptr);
+	D_ASSERT(upper > 0);
+	while (upper - lower > 1) {
+		auto middle = lower + (upper - lower) / 2;
+		if (GetFrameEntry(base_ptr, middle).row_start <= row) {
+			lower = middle;
+		} else {
+			upper = middle;
+		}
+	}
+	return lower;
+}
+
+void ZSTDStorage::DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t base_ptr,
+                                  const zstd_frame_entry_t &entry, data_ptr_t target) {
+	auto source = base_ptr + entry.offset;
+	size_t res;
+	if (context) {
+		res = duckdb_zstd::ZSTD_decompressDCtx(context, target, entry.uncompressed_size, source, entry.compressed_size);
+	} else {
+		res = duckdb_zstd::ZSTD_decompress(target, entry.uncompressed_size, source, entry.compressed_size);
+	}
+	if (duckdb_zstd::ZSTD_isError(res) || res != entry.uncompressed_size) {
+		throw IOException("ZSTD decompression of a column segment failed");
+	}
+}
+
+} // namespace duckdb
@@ -1375,6 +1375,11 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 	return row_groups->CopyStats(column_id);
 }
 
+vector<unique_ptr<BaseStatistics>> DataTable::GetRowGroupStatistics(column_t column_id) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	return row_groups->GetRowGroupStatistics(column_id);
+}
+
 void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
@@ -268,9 +268,52 @@ idx_t ColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t scan_c
 	return ScanVector(state, result, scan_count, ScanVectorType::SCAN_FLAT_VECTOR);
 }
 
+//! Evaluates the filter once per entry of the dictionary of a dictionary vector, rather than once per row
+static bool TryDictionaryFilterSelection(Vector &result, SelectionVector &sel, idx_t &s_count,
+                                         const TableFilter &filter, idx_t scan_count) {
+	if (result.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(result);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= scan_count) {
+		// only worth it if the dictionary has fewer entries than there are rows
+		return false;
+	}
+	auto dict_count = dictionary_size.GetIndex();
+	auto &dictionary = DictionaryVector::Child(result);
+	UnifiedVectorFormat dict_data;
+	dictionary.ToUnifiedFormat(dict_count, dict_data);
+	SelectionVector dict_sel;
+	idx_t approved_dict_count = dict_count;
+	ColumnSegment::FilterSelection(dict_sel, dictionary, dict_data, filter, dict_count, approved_dict_count);
+
+	// mark the dictionary entries that pass the filter
+	auto entry_matches = make_unsafe_uniq_array<bool>(dict_count);
+	memset(entry_matches.get(), 0, sizeof(bool) * dict_count);
+	for (idx_t i = 0; i < approved_dict_count; i++) {
+		entry_matches[dict_sel.get_index(i)] = true;
+	}
+	// now select the rows that refer to those entries
+	auto &codes = DictionaryVector::SelVector(result);
+	SelectionVector new_sel(s_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < s_count; i++) {
+		auto idx = sel.get_index(i);
+		if (entry_matches[codes.get_index(idx)]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	s_count = result_count;
+	return true;
+}
+
 void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                         SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
 	idx_t scan_count = Scan(transaction, vector_index, state, result);
+	if (TryDictionaryFilterSelection(result, sel, s_count, filter, scan_count)) {
+		return;
+	}
 
 	UnifiedVectorFormat vdata;
 	result.ToUnifiedFormat(scan_count, vdata);
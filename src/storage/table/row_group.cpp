@@ -397,6 +397,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -800,6 +801,14 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx) {
+	auto &column = GetColumn(column_idx);
+	ColumnCheckpointInfo checkpoint_info(info, column_idx);
+	auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
+
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	RowGroupWriteData result;
 	result.states.reserve(columns.size());
@@ -814,10 +823,7 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		ColumnCheckpointInfo checkpoint_info(info, column_idx);
-		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
-		D_ASSERT(checkpoint_state);
+		auto checkpoint_state = WriteColumnToDisk(info, column_idx);
 
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
@@ -846,7 +852,7 @@ bool RowGroup::HasUnloadedDeletes() const {
 	return !deletes_is_loaded;
 }
 
-RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+vector<CompressionType> RowGroup::GetCompressionTypes(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -858,7 +864,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		}
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
+	return compression_types;
+}
 
+RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+	auto compression_types = GetCompressionTypes(writer);
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
@@ -15,6 +15,9 @@
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+#include "duckdb/common/deque.hpp"
 
 namespace duckdb {
 
@@ -610,9 +613,21 @@ struct CollectionCheckpointState {
 	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
 	                          vector<SegmentNode<RowGroup>> &segments, TableStatistics &global_stats)
 	    : collection(collection), writer(writer), scheduler(writer.GetScheduler()), segments(segments),
-	      global_stats(global_stats), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0) {
+	      global_stats(global_stats), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0),
+	      active_memory(0) {
 		writers.resize(segments.size());
+		compression_types.resize(segments.size());
+		write_infos.resize(segments.size());
 		write_data.resize(segments.size());
+
+		// the memory of the concurrently running checkpoint tasks is limited by a reservation
+		idx_t total_size = 0;
+		for (auto &entry : segments) {
+			total_size += entry.node->GetAllocationSize() + collection.GetTypes().size() * Storage::BLOCK_SIZE;
+		}
+		auto &db = collection.GetAttached().GetDatabase();
+		memory_state = BufferManager::GetBufferManager(db).GetTemporaryMemoryManager().Register(db);
+		memory_state->SetRemainingSize(db, total_size);
 	}
 
 	RowGroupCollection &collection;
@@ -620,6 +635,8 @@ struct CollectionCheckpointState {
 	TaskScheduler &scheduler;
 	vector<SegmentNode<RowGroup>> &segments;
 	vector<unique_ptr<RowGroupWriter>> writers;
+	vector<vector<CompressionType>> compression_types;
+	vector<unique_ptr<RowGroupWriteInfo>> write_infos;
 	vector<RowGroupWriteData> write_data;
 	TableStatistics &global_stats;
 	mutex write_lock;
@@ -635,11 +652,22 @@ public:
 		error_manager.ThrowException();
 	}
 
-	void ScheduleTask(unique_ptr<Task> task) {
+	//! Schedules a task that uses (an estimate of) the given amount of memory. The task is held back while the
+	//! running tasks use up the memory reservation
+	void ScheduleTask(unique_ptr<Task> task, idx_t memory = 0) {
+		lock_guard<mutex> guard(task_lock);
 		++total_tasks;
-		scheduler.ScheduleTask(*token, std::move(task));
+		pending_tasks.emplace_back(std::move(task), memory);
+		SchedulePendingTasks();
 	}
-	void FinishTask() {
+	void FinishTask(idx_t memory = 0) {
+		{
+			lock_guard<mutex> guard(task_lock);
+			D_ASSERT(active_memory >= memory);
+			active_memory -= memory;
+			SchedulePendingTasks();
+		}
+		// this has to be the last access to the checkpoint state: it is destroyed once all tasks have completed
 		++completed_tasks;
 	}
 	bool TasksFinished() {
@@ -676,16 +704,45 @@ public:
 		return scheduler.GetTaskFromProducer(*token, task);
 	}
 
+private:
+	void SchedulePendingTasks() {
+		if (HasError()) {
+			// the pending tasks are never executed
+			completed_tasks += pending_tasks.size();
+			pending_tasks.clear();
+			return;
+		}
+		while (!pending_tasks.empty()) {
+			auto memory = pending_tasks.front().second;
+			// we always run at least one task, even if it exceeds the reservation
+			if (active_memory != 0 && active_memory + memory > memory_state->GetReservation()) {
+				break;
+			}
+			active_memory += memory;
+			scheduler.ScheduleTask(*token, std::move(pending_tasks.front().first));
+			pending_tasks.pop_front();
+		}
+	}
+
 private:
 	TaskErrorManager error_manager;
 	unique_ptr<ProducerToken> token;
 	atomic<idx_t> completed_tasks;
 	atomic<idx_t> total_tasks;
+
+	mutex task_lock;
+	//! The memory reservation of the checkpoint tasks
+	unique_ptr<TemporaryMemoryState> memory_state;
+	//! The memory used by the running tasks
+	idx_t active_memory;
+	//! The tasks that have not been scheduled yet, and their memory
+	deque<pair<unique_ptr<Task>, idx_t>> pending_tasks;
 };
 
 class BaseCheckpointTask : public Task {
 public:
-	explicit BaseCheckpointTask(CollectionCheckpointState &checkpoint_state) : checkpoint_state(checkpoint_state) {
+	explicit BaseCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t memory = 0)
+	    : checkpoint_state(checkpoint_state), memory(memory) {
 	}
 
 	virtual void ExecuteTask() = 0;
@@ -693,24 +750,43 @@ public:
 		(void)mode;
 		D_ASSERT(mode == TaskExecutionMode::PROCESS_ALL);
 		if (checkpoint_state.HasError()) {
-			checkpoint_state.FinishTask();
+			checkpoint_state.FinishTask(memory);
 			return TaskExecutionResult::TASK_FINISHED;
 		}
 		try {
 			ExecuteTask();
-			checkpoint_state.FinishTask();
+			checkpoint_state.FinishTask(memory);
 			return TaskExecutionResult::TASK_FINISHED;
 		} catch (std::exception &ex) {
 			checkpoint_state.PushError(ErrorData(ex));
 		} catch (...) { // LCOV_EXCL_START
 			checkpoint_state.PushError(ErrorData("Unknown exception during Checkpoint!"));
 		} // LCOV_EXCL_STOP
-		checkpoint_state.FinishTask();
+		checkpoint_state.FinishTask(memory);
 		return TaskExecutionResult::TASK_ERROR;
 	}
 
 protected:
 	CollectionCheckpointState &checkpoint_state;
+	//! The estimated memory that is used by this task
+	idx_t memory;
+};
+
+class CheckpointColumnTask : public BaseCheckpointTask {
+public:
+	CheckpointColumnTask(CollectionCheckpointState &checkpoint_state, idx_t index, idx_t column_idx, idx_t memory)
+	    : BaseCheckpointTask(checkpoint_state, memory), index(index), column_idx(column_idx) {
+	}
+
+	void ExecuteTask() override {
+		auto &row_group = *checkpoint_state.segments[index].node;
+		auto &write_info = *checkpoint_state.write_infos[index];
+		checkpoint_state.write_data[index].states[column_idx] = row_group.WriteColumnToDisk(write_info, column_idx);
+	}
+
+private:
+	idx_t index;
+	idx_t column_idx;
 };
 
 class CheckpointTask : public BaseCheckpointTask {
@@ -723,7 +799,25 @@ public:
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
-		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
+		auto &row_group_writer = *checkpoint_state.writers[index];
+		checkpoint_state.compression_types[index] = row_group.GetCompressionTypes(row_group_writer);
+		checkpoint_state.write_infos[index] = make_uniq<RowGroupWriteInfo>(
+		    row_group_writer.GetPartialBlockManager(), checkpoint_state.compression_types[index],
+		    row_group_writer.GetCheckpointType());
+
+		// the columns are checkpointed in parallel, their statistics are collected after all tasks have finished
+		auto column_count = checkpoint_state.collection.GetTypes().size();
+		checkpoint_state.write_data[index].states.resize(column_count);
+		if (column_count == 1) {
+			checkpoint_state.write_data[index].states[0] =
+			    row_group.WriteColumnToDisk(*checkpoint_state.write_infos[index], 0);
+			return;
+		}
+		auto memory = row_group.GetAllocationSize() / column_count + Storage::BLOCK_SIZE;
+		for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+			auto column_task = make_uniq<CheckpointColumnTask>(checkpoint_state, index, column_idx, memory);
+			checkpoint_state.ScheduleTask(std::move(column_task), memory);
+		}
 	}
 
 private:
@@ -1001,8 +1095,12 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		if (!row_group_writer) {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
-		auto pointer =
-		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
+		auto &write_data = checkpoint_state.write_data[segment_idx];
+		for (auto &state : write_data.states) {
+			D_ASSERT(state);
+			write_data.statistics.push_back(state->GetStatistics()->Copy());
+		}
+		auto pointer = row_group.Checkpoint(std::move(write_data), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
@@ -1170,6 +1268,14 @@ unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
 	return stats.CopyStats(column_id);
 }
 
+vector<unique_ptr<BaseStatistics>> RowGroupCollection::GetRowGroupStatistics(column_t column_id) {
+	vector<unique_ptr<BaseStatistics>> result;
+	for (auto &row_group : row_groups->Segments()) {
+		result.push_back(row_group.GetStatistics(column_id));
+	}
+	return result;
+}
+
 void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	auto stats_lock = stats.GetLock();
@@ -1,6 +1,8 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -8,10 +10,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), block_size(block_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), block_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +61,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +68,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +96,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, idx_t slot_size) {
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// compressed blocks are stored in separate files per slot size
+	return "duckdb_temp_storage_" + to_string(slot_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), slot_size(slot_size), db(db),
+      file_index(index),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, slot_size))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -119,14 +130,45 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	D_ASSERT(!IsCompressed());
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(data_ptr_t compressed_data, TemporaryFileIndex index) {
+	D_ASSERT(IsCompressed());
+	handle->Write(compressed_data, slot_size, GetPositionInFile(index.block_index));
+
+	// keep track of the actual compressed size of the block (stored in front of the compressed data)
+	TemporaryFileLock lock(file_lock);
+	auto &compressed_size = compressed_sizes[index.block_index];
+	total_compressed_size -= compressed_size;
+	compressed_size = sizeof(idx_t) + Load<idx_t>(compressed_data);
+	total_compressed_size += compressed_size;
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (!IsCompressed()) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle,
+		                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
+		                                                          std::move(reusable_buffer));
+	}
+	// read the compressed slot: the compressed size followed by the compressed data
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+
+	// decompress it into the internal buffer of a newly constructed managed buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size =
+	    duckdb_zstd::ZSTD_decompress(buffer->InternalBuffer(), buffer->AllocSize(),
+	                                 compressed_buffer.get() + sizeof(idx_t), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress temporary block from file \"%s\"", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -154,6 +196,10 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	if (total_compressed_size > 0) {
+		info.compression_ratio = double(compressed_sizes.size() * Storage::BLOCK_ALLOC_SIZE) /
+		                         double(total_compressed_size);
+	}
 	return info;
 }
 
@@ -167,6 +213,11 @@ void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 }
 
 void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index) {
+	auto entry = compressed_sizes.find(index);
+	if (entry != compressed_sizes.end()) {
+		total_compressed_size -= entry->second;
+		compressed_sizes.erase(entry);
+	}
 	// remove the block index from the index manager
 	if (index_manager.RemoveIndex(index)) {
 		// the max_index that is currently in use has decreased
@@ -180,7 +231,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -276,16 +327,46 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	// a compressed block is only worth it if it fits in a smaller slot than an uncompressed block
+	static constexpr idx_t MAX_COMPRESSED_SLOT_SIZE = Storage::BLOCK_ALLOC_SIZE - COMPRESSED_SLOT_SIZE;
+	compressed_buffer = Allocator::Get(db).Allocate(MAX_COMPRESSED_SLOT_SIZE);
+	auto compressed_size = duckdb_zstd::ZSTD_compress(compressed_buffer.get() + sizeof(idx_t),
+	                                                  MAX_COMPRESSED_SLOT_SIZE - sizeof(idx_t), buffer.InternalBuffer(),
+	                                                  buffer.AllocSize(), COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		// the block does not compress well enough (or compression failed): write it uncompressed
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	Store<idx_t>(compressed_size, compressed_buffer.get());
+	// round up to the next slot size, and zero-initialize the padding
+	auto used_size = sizeof(idx_t) + compressed_size;
+	auto slot_size = AlignValue<idx_t, COMPRESSED_SLOT_SIZE>(used_size);
+	D_ASSERT(slot_size <= MAX_COMPRESSED_SLOT_SIZE);
+	memset(compressed_buffer.get() + used_size, 0, slot_size - used_size);
+	return slot_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the block (if enabled) before obtaining the lock
+	AllocatedData compressed_buffer;
+	idx_t slot_size = Storage::BLOCK_ALLOC_SIZE;
+	if (DBConfig::GetConfig(db).options.temp_file_compression) {
+		slot_size = CompressBuffer(buffer, compressed_buffer);
+	}
+
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,7 +376,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -306,7 +388,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (handle->IsCompressed()) {
+		handle->WriteTemporaryFile(compressed_buffer.get(), index);
+	} else {
+		handle->WriteTemporaryFile(buffer, index);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -19,7 +19,13 @@ TemporaryMemoryState::~TemporaryMemoryState() {
 void TemporaryMemoryState::SetRemainingSize(ClientContext &context, idx_t new_remaining_size) {
 	auto guard = temporary_memory_manager.Lock();
 	temporary_memory_manager.SetRemainingSize(*this, new_remaining_size);
-	temporary_memory_manager.UpdateState(context, *this);
+	temporary_memory_manager.UpdateState(*context.db, context.config.force_external, *this);
+}
+
+void TemporaryMemoryState::SetRemainingSize(DatabaseInstance &db, idx_t new_remaining_size) {
+	auto guard = temporary_memory_manager.Lock();
+	temporary_memory_manager.SetRemainingSize(*this, new_remaining_size);
+	temporary_memory_manager.UpdateState(db, false, *this);
 }
 
 idx_t TemporaryMemoryState::GetRemainingSize() const {
@@ -41,9 +47,9 @@ unique_lock<mutex> TemporaryMemoryManager::Lock() {
 	return unique_lock<mutex>(lock);
 }
 
-void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
-	auto &buffer_manager = BufferManager::GetBufferManager(context);
-	auto &task_scheduler = TaskScheduler::GetScheduler(context);
+void TemporaryMemoryManager::UpdateConfiguration(DatabaseInstance &db) {
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto &task_scheduler = TaskScheduler::GetScheduler(db);
 
 	memory_limit = NumericCast<idx_t>(MAXIMUM_MEMORY_LIMIT_RATIO * static_cast<double>(buffer_manager.GetMaxMemory()));
 	has_temporary_directory = buffer_manager.HasTemporaryDirectory();
@@ -56,8 +62,12 @@ TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 }
 
 unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context) {
+	return Register(*context.db);
+}
+
+unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(DatabaseInstance &db) {
 	auto guard = Lock();
-	UpdateConfiguration(context);
+	UpdateConfiguration(db);
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
@@ -70,10 +80,11 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	return result;
 }
 
-void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
-	UpdateConfiguration(context);
+void TemporaryMemoryManager::UpdateState(DatabaseInstance &db, bool force_external,
+                                         TemporaryMemoryState &temporary_memory_state) {
+	UpdateConfiguration(db);
 
-	if (context.config.force_external) {
+	if (force_external) {
 		// We're forcing external processing. Give it the minimum
 		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
 	} else if (!has_temporary_directory) {
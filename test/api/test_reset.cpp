@@ -58,6 +58,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_force_external", {Value(true)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"force_index_join", {Value(true)}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"enable_view_dependencies", {Value(true)}},
@@ -84,6 +85,8 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"force_compression", {"uncompressed", "Uncompressed"}},
 	    {"home_directory", {"test"}},
 	    {"allow_extensions_metadata_mismatch", {"true"}},
+	    {"index_scan_max_count", {Value::UBIGINT(100)}},
+	    {"index_scan_percentage", {Value::DOUBLE(0.5)}},
 	    {"integer_division", {true}},
 	    {"extension_directory", {"test"}},
 	    {"immediate_transaction_mode", {true}},
@@ -105,8 +108,10 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {true}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
+	    {"threads_per_numa_node", {4}},
 	    {"enable_http_metadata_cache", {true}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"allocator_flush_threshold", {"4.0 GiB"}},
@@ -1247,6 +1247,14 @@ uint64_t get_size() {
 	return HLL_DENSE_SIZE;
 }
 
+uint64_t get_register_count() {
+	return HLL_REGISTERS;
+}
+
+uint8_t get_max_register_value() {
+	return HLL_Q + 1;
+}
+
 }
 
 namespace duckdb {
@@ -1284,4 +1292,22 @@ void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t in
 	}
 }
 
+uint8_t GetRegisterInternal(void *log, idx_t index) {
+	const auto o = (duckdb_hll::robj *)log;
+	duckdb_hll::hllhdr *hdr = (duckdb_hll::hllhdr *)o->ptr;
+	D_ASSERT(hdr->encoding == HLL_DENSE);
+
+	uint8_t value;
+	HLL_DENSE_GET_REGISTER(value, hdr->registers + 1, index);
+	return value;
+}
+
+void MergeRegisterInternal(void *log, idx_t index, uint8_t value) {
+	const auto o = (duckdb_hll::robj *)log;
+	duckdb_hll::hllhdr *hdr = (duckdb_hll::hllhdr *)o->ptr;
+	D_ASSERT(hdr->encoding == HLL_DENSE);
+
+	duckdb_hll::hllDenseSet(hdr->registers + 1, index, value);
+}
+
 } // namespace duckdb
@@ -39,6 +39,10 @@ int hll_count(robj *o, size_t *result);
 robj *hll_merge(robj **hlls, size_t hll_count);
 //! Get size (in bytes) of the HLL
 uint64_t get_size();
+//! Get the number of registers of the HLL
+uint64_t get_register_count();
+//! Get the maximum value a register of the HLL can hold
+uint8_t get_max_register_value();
 
 uint64_t MurmurHash64A(const void *key, int len, unsigned int seed);
 
@@ -53,4 +57,9 @@ void AddToLogsInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices
 
 void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices[], uint8_t counts[], void *log);
 
+//! Get the value of a register of a dense HLL
+uint8_t GetRegisterInternal(void *log, idx_t index);
+//! Set a register of a dense HLL to the maximum of its value and the given value
+void MergeRegisterInternal(void *log, idx_t index, uint8_t value);
+
 } // namespace duckdb
@@ -113,8 +113,10 @@ color_map = {
     "FILTER": "#bae1ff",
     "ORDER_BY": "#facd60",
     "PERFECT_HASH_GROUP_BY": "#ffffba",
+    "STREAMING_GROUP_BY": "#ffffba",
     "HASH_GROUP_BY": "#ffffba",
     "NESTED_LOOP_JOIN": "#ffffba",
+    "INDEX_JOIN": "#ffffba",
     "STREAMING_LIMIT": "#facd60",
     "COLUMN_DATA_SCAN": "#1ac0c6",
     "TOP_N": "#ffdfba"